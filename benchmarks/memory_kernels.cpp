@@ -0,0 +1,57 @@
+#include <cat/linux>
+#include <cat/memory>
+#include <cat/page_allocator>
+#include <cat/string>
+
+#include "memory_kernels.hpp"
+
+void bench::copy(void const* p_source, void* p_destination, long bytes) {
+    cat::copy_memory(p_source, p_destination, bytes);
+}
+
+void bench::move(void const* p_source, void* p_destination, long bytes) {
+    cat::move_memory(p_source, p_destination, bytes);
+}
+
+void bench::set(void* p_destination, unsigned char value, long bytes) {
+    cat::set_memory(p_destination, value, bytes);
+}
+
+auto bench::length(char const* p_string) -> long {
+    return cat::string_length(p_string).raw;
+}
+
+auto bench::compare(char const* p_string_1, char const* p_string_2,
+                    long bytes) -> bool {
+    return cat::compare_strings(cat::String{p_string_1, bytes},
+                                cat::String{p_string_2, bytes});
+}
+
+auto bench::allocate(long bytes) -> void* {
+    cat::PageAllocator allocator;
+    cat::OptionalPtr<char> maybe_memory =
+        allocator.p_alloc_multi<char>(bytes);
+    if (!maybe_memory.has_value()) {
+        return nullptr;
+    }
+    return maybe_memory.value();
+}
+
+void bench::deallocate(void* p_memory, long bytes) {
+    cat::PageAllocator allocator;
+    allocator.free_multi(static_cast<char*>(p_memory), bytes);
+}
+
+auto bench::nanoseconds() -> long {
+    nix::Timespec const time =
+        nix::sys_clock_gettime(nix::ClockId::monotonic).or_exit();
+    return (time.seconds.raw * 1'000'000'000) + time.nanoseconds.raw;
+}
+
+void bench::print(char const* p_string, long length) {
+    _ = cat::print(cat::String{p_string, length});
+}
+
+auto main() -> int {
+    bench::run("libCat");
+}
@@ -0,0 +1,208 @@
+#pragma once
+
+// This harness is shared by the libCat and libC memory kernel benchmarks, so
+// that both measure exactly the same cases. It only uses builtin types,
+// because it is compiled both with and without libCat.
+namespace bench {
+
+// Each benchmark defines these with the kernels that it measures.
+void copy(void const* p_source, void* p_destination, long bytes);
+void move(void const* p_source, void* p_destination, long bytes);
+void set(void* p_destination, unsigned char value, long bytes);
+auto length(char const* p_string) -> long;
+auto compare(char const* p_string_1, char const* p_string_2, long bytes)
+    -> bool;
+
+// Each benchmark defines these with its platform's facilities.
+// Allocate page-aligned memory, or return `nullptr` if that fails.
+auto allocate(long bytes) -> void*;
+void deallocate(void* p_memory, long bytes);
+// Read a monotonic clock.
+auto nanoseconds() -> long;
+void print(char const* p_string, long length);
+
+// Results of kernels that return values are written here, so that those
+// calls cannot be optimized out.
+inline long volatile sink;
+
+// A line of output is built up in this, then printed at once.
+struct Line {
+    char buffer[256];
+    long length = 0;
+
+    void append(char const* p_string) {
+        while (*p_string != '\0' && this->length < 255) {
+            this->buffer[this->length] = *p_string;
+            ++this->length;
+            ++p_string;
+        }
+    }
+
+    // Append `value` right-aligned in a field `width` characters wide.
+    void append(long value, long width) {
+        char digits[24];
+        long digits_count = 0;
+        do {
+            digits[digits_count] = static_cast<char>('0' + (value % 10));
+            ++digits_count;
+            value /= 10;
+        } while (value > 0);
+        for (long i = digits_count; i < width; ++i) {
+            this->append(" ");
+        }
+        while (digits_count > 0) {
+            --digits_count;
+            char const digit[2] = {digits[digits_count], '\0'};
+            this->append(digit);
+        }
+    }
+
+    // Append `hundredths / 100` with two decimal places.
+    void append_fixed(long hundredths, long width) {
+        this->append(hundredths / 100, width - 3);
+        this->append(".");
+        this->append((hundredths % 100) / 10, 1);
+        this->append(hundredths % 10, 1);
+    }
+
+    void print_line() {
+        this->append("\n");
+        print(this->buffer, this->length);
+        this->length = 0;
+    }
+};
+
+// Sizes are doubled from this up to `max_bytes`.
+inline constexpr long min_bytes = 8;
+inline constexpr long max_bytes = 1l << 30;
+// Each case is repeated until at least this many bytes were processed, so
+// that small sizes are timed over many calls.
+inline constexpr long bytes_per_case = 64l << 20;
+// Sources and destinations are offset by up to this many bytes.
+inline constexpr long padding_bytes = 64;
+
+// Time `kernel` on buffers of `bytes`, then print its throughput in GB/s and
+// its cost in cycles per byte.
+// `rdtsc` counts cycles at a constant reference frequency, which is not
+// necessarily the frequency that the core is running at.
+template <typename Kernel>
+void measure(char const* p_kernel_name, char const* p_case_name, long bytes,
+             Kernel kernel) {
+    long iterations = bytes_per_case / bytes;
+    if (iterations < 3) {
+        iterations = 3;
+    }
+
+    // Warm up the caches and fault in the pages first.
+    kernel();
+
+    long const start_nanoseconds = nanoseconds();
+    unsigned long long const start_cycles = __builtin_ia32_rdtsc();
+    for (long i = 0; i < iterations; ++i) {
+        kernel();
+        // Prevent calls from being merged or hoisted out of this loop.
+        asm volatile("" ::: "memory");
+    }
+    unsigned long long const end_cycles = __builtin_ia32_rdtsc();
+    long elapsed_nanoseconds = nanoseconds() - start_nanoseconds;
+    if (elapsed_nanoseconds < 1) {
+        elapsed_nanoseconds = 1;
+    }
+
+    long const total_bytes = bytes * iterations;
+    long const cycles = static_cast<long>(end_cycles - start_cycles);
+
+    Line line;
+    line.append(p_kernel_name);
+    line.append(p_case_name);
+    line.append(bytes, 12);
+    line.append(" B ");
+    // One byte per nanosecond is one gigabyte per second.
+    line.append_fixed((total_bytes * 100) / elapsed_nanoseconds, 10);
+    line.append(" GB/s ");
+    line.append_fixed((cycles * 100) / total_bytes, 10);
+    line.append(" cycles/B");
+    line.print_line();
+}
+
+// Measure every kernel across every size, alignment and overlap case.
+inline void run(char const* p_library_name) {
+    // Find the largest buffers that can be allocated, up to `max_bytes`.
+    long buffer_bytes = max_bytes;
+    char* p_source = nullptr;
+    char* p_destination = nullptr;
+    while (buffer_bytes >= min_bytes) {
+        p_source = static_cast<char*>(allocate(buffer_bytes + padding_bytes));
+        p_destination =
+            static_cast<char*>(allocate(buffer_bytes + padding_bytes));
+        if (p_source != nullptr && p_destination != nullptr) {
+            break;
+        }
+        if (p_source != nullptr) {
+            deallocate(p_source, buffer_bytes + padding_bytes);
+        }
+        if (p_destination != nullptr) {
+            deallocate(p_destination, buffer_bytes + padding_bytes);
+        }
+        buffer_bytes /= 2;
+    }
+    if (p_source == nullptr) {
+        Line line;
+        line.append("Failed to allocate benchmark buffers!");
+        line.print_line();
+        return;
+    }
+
+    // Fill these buffers with non-null bytes, so that they are also valid
+    // strings to measure.
+    set(p_source, 'a', buffer_bytes + padding_bytes);
+    set(p_destination, 'a', buffer_bytes + padding_bytes);
+
+    Line header;
+    header.append(p_library_name);
+    header.append(" memory kernels:");
+    header.print_line();
+
+    for (long bytes = min_bytes; bytes <= buffer_bytes; bytes *= 2) {
+        measure("copy    ", "  aligned     ", bytes, [&] {
+            copy(p_source, p_destination, bytes);
+        });
+        measure("copy    ", "  unaligned   ", bytes, [&] {
+            copy(p_source + 1, p_destination + 3, bytes);
+        });
+        // The destination overlaps the end of the source.
+        measure("move    ", "  overlap up  ", bytes, [&] {
+            move(p_source, p_source + 8, bytes);
+        });
+        // The destination overlaps the start of the source.
+        measure("move    ", "  overlap down", bytes, [&] {
+            move(p_source + 8, p_source, bytes);
+        });
+        measure("set     ", "  aligned     ", bytes, [&] {
+            set(p_destination, 'b', bytes);
+        });
+        measure("set     ", "  unaligned   ", bytes, [&] {
+            set(p_destination + 3, 'b', bytes);
+        });
+
+        p_source[bytes] = '\0';
+        measure("length  ", "  aligned     ", bytes, [&] {
+            sink = length(p_source);
+        });
+        measure("length  ", "  unaligned   ", bytes - 1, [&] {
+            sink = length(p_source + 1);
+        });
+        p_source[bytes] = 'a';
+
+        // Equal strings must be compared in full.
+        set(p_destination, 'a', bytes + padding_bytes);
+        measure("compare ", "  equal       ", bytes, [&] {
+            sink = compare(p_source, p_destination, bytes);
+        });
+    }
+
+    deallocate(p_source, buffer_bytes + padding_bytes);
+    deallocate(p_destination, buffer_bytes + padding_bytes);
+}
+
+}  // namespace bench
@@ -0,0 +1,52 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#include "memory_kernels.hpp"
+
+void bench::copy(void const* p_source, void* p_destination, long bytes) {
+    memcpy(p_destination, p_source, static_cast<size_t>(bytes));
+}
+
+void bench::move(void const* p_source, void* p_destination, long bytes) {
+    memmove(p_destination, p_source, static_cast<size_t>(bytes));
+}
+
+void bench::set(void* p_destination, unsigned char value, long bytes) {
+    memset(p_destination, value, static_cast<size_t>(bytes));
+}
+
+auto bench::length(char const* p_string) -> long {
+    return static_cast<long>(strlen(p_string));
+}
+
+auto bench::compare(char const* p_string_1, char const* p_string_2,
+                    long bytes) -> bool {
+    return memcmp(p_string_1, p_string_2, static_cast<size_t>(bytes)) == 0;
+}
+
+auto bench::allocate(long bytes) -> void* {
+    // `aligned_alloc()` requires a multiple of the alignment.
+    long const page_bytes = (bytes + 4'095) & ~4'095l;
+    return aligned_alloc(4'096, static_cast<size_t>(page_bytes));
+}
+
+void bench::deallocate(void* p_memory, long) {
+    free(p_memory);
+}
+
+auto bench::nanoseconds() -> long {
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (time.tv_sec * 1'000'000'000) + time.tv_nsec;
+}
+
+void bench::print(char const* p_string, long length) {
+    fwrite(p_string, 1, static_cast<size_t>(length), stdout);
+    fflush(stdout);
+}
+
+auto main() -> int {
+    bench::run("libC");
+}
@@ -0,0 +1,12 @@
+#include <cat/linux>
+
+// `nix::sys_clock_gettime()` wraps the `clock_gettime` Linux syscall.
+auto nix::sys_clock_gettime(nix::ClockId clock)
+    -> cat::Scaredy<nix::Timespec, nix::LinuxError> {
+    nix::Timespec time;
+    nix::ScaredyLinux<void> result = nix::syscall<void>(228, clock, &time);
+    if (result.has_value()) {
+        return time;
+    }
+    return result.error<nix::LinuxError>();
+}
@@ -0,0 +1,7 @@
+#include <cat/linux>
+
+// `nix::sys_madvise()` wraps the `madvise` Linux syscall.
+auto nix::sys_madvise(void* p_memory, ssize length, nix::MemoryAdvice advice)
+    -> nix::ScaredyLinux<void> {
+    return nix::syscall<void>(28, p_memory, length, advice);
+}
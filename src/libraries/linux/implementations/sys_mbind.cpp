@@ -0,0 +1,10 @@
+#include <cat/linux>
+
+// `nix::sys_mbind()` wraps the `mbind` Linux syscall. This sets the NUMA
+// memory policy for a range of pages.
+auto nix::sys_mbind(void* p_memory, ssize length, nix::MemoryPolicy policy,
+                    usize const* p_node_mask, usize max_node, usize flags)
+    -> nix::ScaredyLinux<void> {
+    return nix::syscall<void>(237, p_memory, length, policy, p_node_mask,
+                              max_node, flags);
+}
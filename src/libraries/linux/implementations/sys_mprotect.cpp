@@ -0,0 +1,9 @@
+#include <cat/linux>
+
+// `nix::sys_mprotect()` wraps the `mprotect` Linux syscall. This changes the
+// access protections of page(s) of virtual memory.
+auto nix::sys_mprotect(void* p_memory, ssize length,
+                       nix::MemoryProtectionFlags protections)
+    -> nix::ScaredyLinux<void> {
+    return nix::syscall<void>(10, p_memory, length, protections);
+}
@@ -0,0 +1,8 @@
+#include <cat/linux>
+
+// `nix::sys_mremap()` wraps the `mremap` Linux syscall. This returns the
+// virtual memory address of the resized mapping.
+auto nix::sys_mremap(void const* p_memory, ssize old_length, ssize new_length,
+                     nix::RemapFlags flags) -> nix::ScaredyLinux<void*> {
+    return nix::syscall<void*>(25, p_memory, old_length, new_length, flags);
+}
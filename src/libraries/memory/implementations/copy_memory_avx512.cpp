@@ -0,0 +1,77 @@
+#include <cat/memory>
+#include <cat/simd>
+
+// Copy some bytes from one address to another address with AVX-512.
+// `tree-loop-distribute-patterns` is an optimization that replaces the byte
+// loops here with a call to `memcpy`. As this function is called within
+// `memcpy`, that produces an infinite loop.
+[[gnu::target("avx512f,avx512bw,avx512dq"),
+  gnu::optimize("-fno-tree-loop-distribute-patterns")]] void
+cat::detail::copy_memory_avx512(void const* p_source, void* p_destination,
+                                ssize bytes) {
+    using Vector = int8x8;
+
+    unsigned char const* p_source_handle =
+        static_cast<unsigned char const*>(p_source);
+    unsigned char* p_destination_handle =
+        static_cast<unsigned char*>(p_destination);
+    constexpr ssize::Raw step_size = ssizeof<Vector>().raw * 4;
+    ssize::Raw bytes_left = bytes.raw;
+
+    if (bytes_left <= step_size) {
+        copy_memory_small_avx2(p_source, p_destination, bytes);
+        return;
+    }
+
+    // Mid-sized copies are fastest with `rep movsb`, where it is supported.
+    if (bytes >= rep_movsb_threshold && bytes <= non_temporal_threshold) {
+        rep_move_bytes(p_source, p_destination, bytes);
+        return;
+    }
+
+    // Align the destination to the vector's optimal alignment.
+    ssize::Raw const padding = static_cast<ssize::Raw>(
+        (alignof(Vector) -
+         (__builtin_bit_cast(__UINTPTR_TYPE__, p_destination_handle) &
+          (alignof(Vector) - 1))) &
+        (alignof(Vector) - 1));
+    copy_memory_small_avx2(p_source_handle, p_destination_handle, padding);
+    p_source_handle += padding;
+    p_destination_handle += padding;
+    bytes_left -= padding;
+
+    Vector vectors[4];
+    while (bytes_left >= step_size) {
+#pragma GCC unroll 4
+        for (int i = 0; i < 4; ++i) {
+            vectors[i] = Vector::loaded_unaligned(
+                static_cast<Vector::Scalar const*>(
+                    static_cast<void const*>(p_source_handle)) +
+                (i * Vector::lanes.raw));
+        }
+        prefetch_for_one_read(p_source_handle + (step_size * 2));
+
+        // Buffers larger than the cache are streamed past it.
+        if (bytes <= non_temporal_threshold) {
+#pragma GCC unroll 4
+            for (int i = 0; i < 4; ++i) {
+                static_cast<Vector*>(
+                    static_cast<void*>(p_destination_handle))[i] = vectors[i];
+            }
+        } else {
+#pragma GCC unroll 4
+            for (int i = 0; i < 4; ++i) {
+                stream_in(p_destination_handle + (i * 64), &vectors[i]);
+            }
+        }
+        p_source_handle += step_size;
+        p_destination_handle += step_size;
+        bytes_left -= step_size;
+    }
+    if (bytes > non_temporal_threshold) {
+        sfence();
+    }
+
+    copy_memory_small_avx2(p_source_handle, p_destination_handle, bytes_left);
+    zero_upper_avx_registers();
+}
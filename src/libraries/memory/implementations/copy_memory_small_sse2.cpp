@@ -0,0 +1,142 @@
+#include <cat/memory>
+
+// Copy some bytes with a few overlapping loads and stores, rather than a
+// loop, with SSE2. This is the fallback for CPUs that do not support AVX2, so
+// it is compiled for the baseline x86-64 ISA. Every copy of up to 128 bytes
+// is a head and a tail, which may overlap each other. Every load is made
+// before any store, so this is safe for `move_memory()` to call on ranges
+// where the destination is below the source.
+// `tree-loop-distribute-patterns` is an optimization that replaces this code
+// with a call to `memcpy`. As this function is called within `memcpy`, that
+// produces an infinite loop.
+[[gnu::target("arch=x86-64"),
+  gnu::optimize("-fno-tree-loop-distribute-patterns")]] void
+cat::detail::copy_memory_small_sse2(void const* p_source, void* p_destination,
+                                    ssize bytes) {
+    // These types can be loaded from and stored to any address.
+    using Vector16 [[gnu::vector_size(16), gnu::aligned(1)]] = unsigned char;
+    using Word8 [[gnu::aligned(1)]] = __UINT64_TYPE__;
+    using Word4 [[gnu::aligned(1)]] = __UINT32_TYPE__;
+    using Word2 [[gnu::aligned(1)]] = __UINT16_TYPE__;
+
+    unsigned char const* p_source_handle =
+        static_cast<unsigned char const*>(p_source);
+    unsigned char* p_destination_handle =
+        static_cast<unsigned char*>(p_destination);
+    ssize::Raw const size = bytes.raw;
+
+    unsigned char const* const p_source_end = p_source_handle + size;
+    unsigned char* const p_destination_end = p_destination_handle + size;
+
+    if (size <= 0) {
+        return;
+    }
+
+    // Each of these sizes is covered by a head and a tail of the same width,
+    // which overlap each other.
+    if (size < 64) {
+        if (size >= 32) {
+            Vector16 const* p_source_vectors =
+                static_cast<Vector16 const*>(p_source);
+            Vector16 const* p_source_tail = static_cast<Vector16 const*>(
+                static_cast<void const*>(p_source_end - 32));
+            Vector16 const head_1 = p_source_vectors[0];
+            Vector16 const head_2 = p_source_vectors[1];
+            Vector16 const tail_1 = p_source_tail[0];
+            Vector16 const tail_2 = p_source_tail[1];
+            Vector16* p_destination_vectors =
+                static_cast<Vector16*>(p_destination);
+            Vector16* p_destination_tail = static_cast<Vector16*>(
+                static_cast<void*>(p_destination_end - 32));
+            p_destination_vectors[0] = head_1;
+            p_destination_vectors[1] = head_2;
+            p_destination_tail[0] = tail_1;
+            p_destination_tail[1] = tail_2;
+        } else if (size >= 16) {
+            Vector16 const head = *static_cast<Vector16 const*>(p_source);
+            Vector16 const tail = *static_cast<Vector16 const*>(
+                static_cast<void const*>(p_source_end - 16));
+            *static_cast<Vector16*>(p_destination) = head;
+            *static_cast<Vector16*>(
+                static_cast<void*>(p_destination_end - 16)) = tail;
+        } else if (size >= 8) {
+            Word8 const head = *static_cast<Word8 const*>(p_source);
+            Word8 const tail = *static_cast<Word8 const*>(
+                static_cast<void const*>(p_source_end - 8));
+            *static_cast<Word8*>(p_destination) = head;
+            *static_cast<Word8*>(static_cast<void*>(p_destination_end - 8)) =
+                tail;
+        } else if (size >= 4) {
+            Word4 const head = *static_cast<Word4 const*>(p_source);
+            Word4 const tail = *static_cast<Word4 const*>(
+                static_cast<void const*>(p_source_end - 4));
+            *static_cast<Word4*>(p_destination) = head;
+            *static_cast<Word4*>(static_cast<void*>(p_destination_end - 4)) =
+                tail;
+        } else if (size >= 2) {
+            Word2 const head = *static_cast<Word2 const*>(p_source);
+            Word2 const tail = *static_cast<Word2 const*>(
+                static_cast<void const*>(p_source_end - 2));
+            *static_cast<Word2*>(p_destination) = head;
+            *static_cast<Word2*>(static_cast<void*>(p_destination_end - 2)) =
+                tail;
+        } else {
+            *p_destination_handle = *p_source_handle;
+        }
+        return;
+    }
+
+    Vector16 const* p_source_vectors =
+        static_cast<Vector16 const*>(static_cast<void const*>(p_source_handle));
+    Vector16 const* p_source_tail = static_cast<Vector16 const*>(
+        static_cast<void const*>(p_source_end - 64));
+    Vector16* p_destination_tail =
+        static_cast<Vector16*>(static_cast<void*>(p_destination_end - 64));
+
+    // The last 64 bytes are loaded first, so that storing earlier bytes can
+    // not overwrite them when the ranges overlap.
+    Vector16 tail[4];
+#pragma GCC unroll 4
+    for (int i = 0; i < 4; ++i) {
+        tail[i] = p_source_tail[i];
+    }
+
+    if (size <= 128) {
+        Vector16 head[4];
+#pragma GCC unroll 4
+        for (int i = 0; i < 4; ++i) {
+            head[i] = p_source_vectors[i];
+        }
+        Vector16* p_destination_vectors =
+            static_cast<Vector16*>(static_cast<void*>(p_destination_handle));
+#pragma GCC unroll 4
+        for (int i = 0; i < 4; ++i) {
+            p_destination_vectors[i] = head[i];
+        }
+    } else {
+        // Larger copies are only the remainders of vectorized kernels' loops,
+        // so this loop runs at most a few times.
+        ssize::Raw offset = 0;
+        while (offset < size - 64) {
+            Vector16 const* p_source_chunk = static_cast<Vector16 const*>(
+                static_cast<void const*>(p_source_handle + offset));
+            Vector16 chunk[4];
+#pragma GCC unroll 4
+            for (int i = 0; i < 4; ++i) {
+                chunk[i] = p_source_chunk[i];
+            }
+            Vector16* p_destination_chunk = static_cast<Vector16*>(
+                static_cast<void*>(p_destination_handle + offset));
+#pragma GCC unroll 4
+            for (int i = 0; i < 4; ++i) {
+                p_destination_chunk[i] = chunk[i];
+            }
+            offset += 64;
+        }
+    }
+
+#pragma GCC unroll 4
+    for (int i = 0; i < 4; ++i) {
+        p_destination_tail[i] = tail[i];
+    }
+}
@@ -0,0 +1,89 @@
+#include <cat/memory>
+
+// Copy some bytes from one address to another address with SSE2. This is the
+// fallback for CPUs that do not support AVX2, so it is compiled for the
+// baseline x86-64 ISA rather than the ISA that libCat is built for.
+// `tree-loop-distribute-patterns` is an optimization that replaces the byte
+// loops here with a call to `memcpy`. As this function is called within
+// `memcpy`, that produces an infinite loop.
+[[gnu::target("arch=x86-64"),
+  gnu::optimize("-fno-tree-loop-distribute-patterns")]] void
+cat::detail::copy_memory_sse2(void const* p_source, void* p_destination,
+                              ssize bytes) {
+    using Vector [[gnu::vector_size(16)]] = long long;
+    using UnalignedVector [[gnu::vector_size(16), gnu::aligned(1)]] =
+        long long;
+
+    unsigned char const* p_source_handle =
+        static_cast<unsigned char const*>(p_source);
+    unsigned char* p_destination_handle =
+        static_cast<unsigned char*>(p_destination);
+    ssize::Raw bytes_left = bytes.raw;
+
+    // Mid-sized copies are fastest with `rep movsb`, where it is supported.
+    if (bytes >= rep_movsb_threshold && bytes <= non_temporal_threshold) {
+        rep_move_bytes(p_source, p_destination, bytes);
+        return;
+    }
+
+    // Align the destination to the vector's optimal alignment.
+    while (bytes_left > 0 &&
+           (__builtin_bit_cast(__UINTPTR_TYPE__, p_destination_handle) &
+            (alignof(Vector) - 1)) != 0) {
+        *p_destination_handle = *p_source_handle;
+        ++p_source_handle;
+        ++p_destination_handle;
+        --bytes_left;
+    }
+
+    // Copy four vectors at a time, so that several loads are in flight.
+    while (bytes_left >= 64) {
+        UnalignedVector const* p_vectors =
+            static_cast<UnalignedVector const*>(
+                static_cast<void const*>(p_source_handle));
+        Vector vectors[4];
+#pragma GCC unroll 4
+        for (int i = 0; i < 4; ++i) {
+            vectors[i] = p_vectors[i];
+        }
+        // Buffers larger than the cache are streamed past it.
+        if (bytes <= non_temporal_threshold) {
+#pragma GCC unroll 4
+            for (int i = 0; i < 4; ++i) {
+                static_cast<Vector*>(
+                    static_cast<void*>(p_destination_handle))[i] = vectors[i];
+            }
+        } else {
+#pragma GCC unroll 4
+            for (int i = 0; i < 4; ++i) {
+                __builtin_ia32_movntdq(
+                    static_cast<Vector*>(
+                        static_cast<void*>(p_destination_handle)) +
+                        i,
+                    vectors[i]);
+            }
+        }
+        p_source_handle += 64;
+        p_destination_handle += 64;
+        bytes_left -= 64;
+    }
+    if (bytes > non_temporal_threshold) {
+        __builtin_ia32_sfence();
+    }
+
+    while (bytes_left >= 16) {
+        *static_cast<Vector*>(static_cast<void*>(p_destination_handle)) =
+            *static_cast<UnalignedVector const*>(
+                static_cast<void const*>(p_source_handle));
+        p_source_handle += 16;
+        p_destination_handle += 16;
+        bytes_left -= 16;
+    }
+
+    while (bytes_left > 0) {
+        *p_destination_handle = *p_source_handle;
+        ++p_source_handle;
+        ++p_destination_handle;
+        --bytes_left;
+    }
+}
@@ -0,0 +1,7 @@
+#include <cat/memory>
+
+// Copy some bytes from one address to another address, where those ranges may
+// overlap.
+void cat::move_memory(void const* p_source, void* p_destination, ssize bytes) {
+    detail::p_move_memory(p_source, p_destination, bytes);
+}
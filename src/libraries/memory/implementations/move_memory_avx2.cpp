@@ -0,0 +1,183 @@
+#include <cat/bit>
+#include <cat/memory>
+#include <cat/simd>
+
+// Copy some bytes from one address to another address, where those ranges may
+// overlap, with AVX2.
+// `tree-loop-distribute-patterns` is an optimization that replaces the loops
+// here with a call to `memmove`. As this function is called within
+// `memmove`, that produces an infinite loop.
+[[gnu::target("avx2"),
+  gnu::optimize("-fno-tree-loop-distribute-patterns")]] void
+cat::detail::move_memory_avx2(void const* p_source, void* p_destination,
+                              ssize bytes) {
+    using Vector = int8x_;
+    // This type can be loaded from and stored to any address.
+    using UnalignedVector [[gnu::vector_size(32), gnu::aligned(1)]] =
+        unsigned char;
+
+    unsigned char const* p_source_handle =
+        static_cast<unsigned char const*>(p_source);
+    unsigned char* p_destination_handle =
+        static_cast<unsigned char*>(p_destination);
+    constexpr ssize step_size = ssizeof<Vector>() * 8;
+    Vector vectors[8];
+
+    if (p_destination_handle == p_source_handle || bytes <= 0) {
+        return;
+    }
+
+    // If the destination is below the source, or the ranges do not overlap,
+    // then copying forward never overwrites bytes before they are loaded.
+    if (p_destination_handle < p_source_handle ||
+        p_destination_handle >= p_source_handle + bytes.raw) {
+        if (bytes <= step_size) {
+            copy_memory_small_avx2(p_source_handle, p_destination_handle,
+                                   bytes);
+            return;
+        }
+
+        // Align the destination to the vector's optimal alignment.
+        ssize const padding = static_cast<ssize::Raw>(
+            align_up(p_destination_handle, alignof(Vector)) -
+            p_destination_handle);
+        copy_memory_small_avx2(p_source_handle, p_destination_handle,
+                               padding);
+        p_source_handle += padding.raw;
+        p_destination_handle += padding.raw;
+        bytes -= padding;
+
+        // Every vector is loaded before any of them are stored, so that this
+        // is safe when the ranges are less than a step apart.
+        if (bytes <= non_temporal_threshold) {
+            while (bytes >= step_size) {
+#pragma GCC unroll 8
+                for (int i = 0; i < 8; ++i) {
+                    vectors[i] = Vector::loaded_unaligned(
+                        bit_cast<Vector::Scalar const*>(p_source_handle) +
+                        (i * Vector::lanes.raw));
+                }
+                prefetch_for_one_read(p_source_handle + (step_size * 2).raw);
+
+#pragma GCC unroll 8
+                for (int i = 0; i < 8; ++i) {
+                    bit_cast<Vector*>(p_destination_handle)[i] = vectors[i];
+                }
+                p_source_handle += step_size.raw;
+                p_destination_handle += step_size.raw;
+                bytes -= step_size;
+            }
+        } else {
+            while (bytes >= step_size) {
+#pragma GCC unroll 8
+                for (int i = 0; i < 8; ++i) {
+                    vectors[i] = Vector::loaded_unaligned(
+                        bit_cast<Vector::Scalar const*>(p_source_handle) +
+                        (i * Vector::lanes.raw));
+                }
+                prefetch_for_one_read(p_source_handle + (step_size * 2).raw);
+
+#pragma GCC unroll 8
+                for (int i = 0; i < 8; ++i) {
+                    stream_in(p_destination_handle + (i * 32), &vectors[i]);
+                }
+                p_source_handle += step_size.raw;
+                p_destination_handle += step_size.raw;
+                bytes -= step_size;
+            }
+            sfence();
+        }
+
+        copy_memory_small_avx2(p_source_handle, p_destination_handle,
+                               bytes);
+        zero_upper_avx_registers();
+        return;
+    }
+
+    // Otherwise, the destination overlaps the end of the source, so this must
+    // copy backward from the end. Copies of up to 128 bytes make every load
+    // before any store.
+    if (bytes <= 128) {
+        copy_memory_small_avx2(p_source_handle, p_destination_handle,
+                               bytes);
+        return;
+    }
+
+    unsigned char const* p_source_end = p_source_handle + bytes.raw;
+    unsigned char* p_destination_end = p_destination_handle + bytes.raw;
+
+    // The first and last vectors are loaded before any store, and they are
+    // stored after every other vector, so they can overlap the aligned
+    // vectors between them.
+    UnalignedVector const head = *static_cast<UnalignedVector const*>(
+        static_cast<void const*>(p_source_handle));
+    UnalignedVector const tail = *static_cast<UnalignedVector const*>(
+        static_cast<void const*>(p_source_end - ssizeof<Vector>().raw));
+    unsigned char* const p_destination_tail =
+        p_destination_end - ssizeof<Vector>().raw;
+
+    // Align the end of the destination to the vector's optimal alignment.
+    // The bytes past it are covered by `tail`.
+    ssize const padding = static_cast<ssize::Raw>(
+        p_destination_end - align_down(p_destination_end, alignof(Vector)));
+    p_source_end -= padding.raw;
+    p_destination_end -= padding.raw;
+    bytes -= padding;
+
+    // Every vector is loaded before any of them are stored, so that this is
+    // safe when the ranges are less than a step apart.
+    if (bytes <= non_temporal_threshold) {
+        while (bytes >= step_size) {
+            p_source_end -= step_size.raw;
+            p_destination_end -= step_size.raw;
+#pragma GCC unroll 8
+            for (int i = 0; i < 8; ++i) {
+                vectors[i] = Vector::loaded_unaligned(
+                    bit_cast<Vector::Scalar const*>(p_source_end) +
+                    (i * Vector::lanes.raw));
+            }
+            prefetch_for_one_read(p_source_end - step_size.raw);
+
+#pragma GCC unroll 8
+            for (int i = 0; i < 8; ++i) {
+                bit_cast<Vector*>(p_destination_end)[i] = vectors[i];
+            }
+            bytes -= step_size;
+        }
+    } else {
+        while (bytes >= step_size) {
+            p_source_end -= step_size.raw;
+            p_destination_end -= step_size.raw;
+#pragma GCC unroll 8
+            for (int i = 0; i < 8; ++i) {
+                vectors[i] = Vector::loaded_unaligned(
+                    bit_cast<Vector::Scalar const*>(p_source_end) +
+                    (i * Vector::lanes.raw));
+            }
+            prefetch_for_one_read(p_source_end - step_size.raw);
+
+#pragma GCC unroll 8
+            for (int i = 0; i < 8; ++i) {
+                stream_in(p_destination_end + (i * 32), &vectors[i]);
+            }
+            bytes -= step_size;
+        }
+        sfence();
+    }
+
+    // Copy one vector at a time, until only the bytes covered by `head`
+    // remain.
+    while (bytes > ssizeof<Vector>()) {
+        p_source_end -= ssizeof<Vector>().raw;
+        p_destination_end -= ssizeof<Vector>().raw;
+        *bit_cast<Vector*>(p_destination_end) = Vector::loaded_unaligned(
+            bit_cast<Vector::Scalar const*>(p_source_end));
+        bytes -= ssizeof<Vector>();
+    }
+
+    *static_cast<UnalignedVector*>(static_cast<void*>(p_destination_handle)) =
+        head;
+    *static_cast<UnalignedVector*>(static_cast<void*>(p_destination_tail)) =
+        tail;
+    zero_upper_avx_registers();
+}
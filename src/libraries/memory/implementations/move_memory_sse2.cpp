@@ -0,0 +1,164 @@
+#include <cat/bit>
+#include <cat/memory>
+#include <cat/simd>
+
+// Copy some bytes from one address to another address, where those ranges may
+// overlap, with SSE2. This is the fallback for CPUs that do not support AVX2,
+// so it is compiled for the baseline x86-64 ISA.
+// `tree-loop-distribute-patterns` is an optimization that replaces the loops
+// here with a call to `memmove`. As this function is called within
+// `memmove`, that produces an infinite loop.
+[[gnu::target("arch=x86-64"),
+  gnu::optimize("-fno-tree-loop-distribute-patterns")]] void
+cat::detail::move_memory_sse2(void const* p_source, void* p_destination,
+                              ssize bytes) {
+    using Vector [[gnu::vector_size(16)]] = long long;
+    // This type can be loaded from and stored to any address.
+    using UnalignedVector [[gnu::vector_size(16), gnu::aligned(1)]] =
+        long long;
+
+    unsigned char const* p_source_handle =
+        static_cast<unsigned char const*>(p_source);
+    unsigned char* p_destination_handle =
+        static_cast<unsigned char*>(p_destination);
+    constexpr ssize step_size = ssizeof<Vector>() * 4;
+    Vector vectors[4];
+    // Buffers larger than the cache are streamed past it.
+    bool const is_streamed = bytes > non_temporal_threshold;
+
+    if (p_destination_handle == p_source_handle || bytes <= 0) {
+        return;
+    }
+
+    // If the destination is below the source, or the ranges do not overlap,
+    // then copying forward never overwrites bytes before they are loaded.
+    if (p_destination_handle < p_source_handle ||
+        p_destination_handle >= p_source_handle + bytes.raw) {
+        if (bytes <= step_size) {
+            copy_memory_small_sse2(p_source_handle, p_destination_handle,
+                                   bytes);
+            return;
+        }
+
+        // Align the destination to the vector's optimal alignment.
+        ssize const padding = static_cast<ssize::Raw>(
+            align_up(p_destination_handle, alignof(Vector)) -
+            p_destination_handle);
+        copy_memory_small_sse2(p_source_handle, p_destination_handle,
+                               padding);
+        p_source_handle += padding.raw;
+        p_destination_handle += padding.raw;
+        bytes -= padding;
+
+        // Every vector is loaded before any of them are stored, so that this
+        // is safe when the ranges are less than a step apart.
+        while (bytes >= step_size) {
+#pragma GCC unroll 4
+            for (int i = 0; i < 4; ++i) {
+                vectors[i] = static_cast<UnalignedVector const*>(
+                    static_cast<void const*>(p_source_handle))[i];
+            }
+            prefetch_for_one_read(p_source_handle + (step_size * 2).raw);
+
+            Vector* const p_destination_vectors =
+                static_cast<Vector*>(static_cast<void*>(p_destination_handle));
+            if (!is_streamed) {
+#pragma GCC unroll 4
+                for (int i = 0; i < 4; ++i) {
+                    p_destination_vectors[i] = vectors[i];
+                }
+            } else {
+#pragma GCC unroll 4
+                for (int i = 0; i < 4; ++i) {
+                    __builtin_ia32_movntdq(p_destination_vectors + i,
+                                           vectors[i]);
+                }
+            }
+            p_source_handle += step_size.raw;
+            p_destination_handle += step_size.raw;
+            bytes -= step_size;
+        }
+        if (is_streamed) {
+            __builtin_ia32_sfence();
+        }
+
+        copy_memory_small_sse2(p_source_handle, p_destination_handle, bytes);
+        return;
+    }
+
+    // Otherwise, the destination overlaps the end of the source, so this must
+    // copy backward from the end. Copies of up to 128 bytes make every load
+    // before any store.
+    if (bytes <= 128) {
+        copy_memory_small_sse2(p_source_handle, p_destination_handle, bytes);
+        return;
+    }
+
+    unsigned char const* p_source_end = p_source_handle + bytes.raw;
+    unsigned char* p_destination_end = p_destination_handle + bytes.raw;
+
+    // The first and last vectors are loaded before any store, and they are
+    // stored after every other vector, so they can overlap the aligned
+    // vectors between them.
+    UnalignedVector const head = *static_cast<UnalignedVector const*>(
+        static_cast<void const*>(p_source_handle));
+    UnalignedVector const tail = *static_cast<UnalignedVector const*>(
+        static_cast<void const*>(p_source_end - ssizeof<Vector>().raw));
+    unsigned char* const p_destination_tail =
+        p_destination_end - ssizeof<Vector>().raw;
+
+    // Align the end of the destination to the vector's optimal alignment.
+    // The bytes past it are covered by `tail`.
+    ssize const padding = static_cast<ssize::Raw>(
+        p_destination_end - align_down(p_destination_end, alignof(Vector)));
+    p_source_end -= padding.raw;
+    p_destination_end -= padding.raw;
+    bytes -= padding;
+
+    // Every vector is loaded before any of them are stored, so that this is
+    // safe when the ranges are less than a step apart.
+    while (bytes >= step_size) {
+        p_source_end -= step_size.raw;
+        p_destination_end -= step_size.raw;
+#pragma GCC unroll 4
+        for (int i = 0; i < 4; ++i) {
+            vectors[i] = static_cast<UnalignedVector const*>(
+                static_cast<void const*>(p_source_end))[i];
+        }
+        prefetch_for_one_read(p_source_end - step_size.raw);
+
+        Vector* const p_destination_vectors =
+            static_cast<Vector*>(static_cast<void*>(p_destination_end));
+        if (!is_streamed) {
+#pragma GCC unroll 4
+            for (int i = 0; i < 4; ++i) {
+                p_destination_vectors[i] = vectors[i];
+            }
+        } else {
+#pragma GCC unroll 4
+            for (int i = 0; i < 4; ++i) {
+                __builtin_ia32_movntdq(p_destination_vectors + i, vectors[i]);
+            }
+        }
+        bytes -= step_size;
+    }
+    if (is_streamed) {
+        __builtin_ia32_sfence();
+    }
+
+    // Copy one vector at a time, until only the bytes covered by `head`
+    // remain.
+    while (bytes > ssizeof<Vector>()) {
+        p_source_end -= ssizeof<Vector>().raw;
+        p_destination_end -= ssizeof<Vector>().raw;
+        *static_cast<Vector*>(static_cast<void*>(p_destination_end)) =
+            *static_cast<UnalignedVector const*>(
+                static_cast<void const*>(p_source_end));
+        bytes -= ssizeof<Vector>();
+    }
+
+    *static_cast<UnalignedVector*>(static_cast<void*>(p_destination_handle)) =
+        head;
+    *static_cast<UnalignedVector*>(static_cast<void*>(p_destination_tail)) =
+        tail;
+}
@@ -0,0 +1,64 @@
+#include <cat/bit>
+#include <cat/memory>
+#include <cat/simd>
+
+// Set some bytes to `byte_value` with AVX2.
+// `tree-loop-distribute-patterns` is an optimization that replaces the loops
+// here with a call to `memset`. As this function is called within `memset`,
+// that produces an infinite loop.
+[[gnu::target("avx2"),
+  gnu::optimize("-fno-tree-loop-distribute-patterns")]] void
+cat::detail::set_memory_avx2(void* p_source, unsigned char byte_value,
+                             ssize bytes) {
+    using Vector = uint1x32;
+    // Four vectors are stored per iteration, so that several stores are in
+    // flight at once.
+    constexpr ssize step_size = ssizeof<Vector>() * 4;
+
+    unsigned char* p_current_byte = static_cast<unsigned char*>(p_source);
+    if (bytes < 32) {
+        set_memory_small(p_current_byte, byte_value, bytes);
+        return;
+    }
+
+    Vector const vector = Vector::filled(byte_value);
+    unsigned char* const p_end = p_current_byte + bytes.raw;
+
+    // The unaligned head and tail are each filled by one overlapping
+    // unaligned store.
+    *static_cast<UnalignedSetVector32*>(static_cast<void*>(p_current_byte)) =
+        vector.raw;
+    *static_cast<UnalignedSetVector32*>(static_cast<void*>(p_end - 32)) =
+        vector.raw;
+
+    // Everything between these is filled with aligned stores.
+    p_current_byte = align_down(p_current_byte + 32, Vector::alignment);
+    unsigned char* const p_aligned_end = align_down(p_end, Vector::alignment);
+
+    // Stores larger than the cache are streamed past it, mirroring
+    // `copy_memory()`.
+    if (bytes <= non_temporal_threshold) {
+        while (p_aligned_end - p_current_byte >= step_size) {
+#pragma GCC unroll 4
+            for (int i = 0; i < 4; ++i) {
+                bit_cast<Vector*>(p_current_byte)[i] = vector;
+            }
+            p_current_byte += step_size.raw;
+        }
+    } else {
+        while (p_aligned_end - p_current_byte >= step_size) {
+#pragma GCC unroll 4
+            for (int i = 0; i < 4; ++i) {
+                stream_in(p_current_byte + (i * 32), &vector);
+            }
+            p_current_byte += step_size.raw;
+        }
+        sfence();
+    }
+
+    // Fill the remaining up to three aligned vectors.
+    while (p_current_byte < p_aligned_end) {
+        *bit_cast<Vector*>(p_current_byte) = vector;
+        p_current_byte += 32;
+    }
+}
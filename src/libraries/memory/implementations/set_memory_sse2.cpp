@@ -0,0 +1,70 @@
+#include <cat/bit>
+#include <cat/memory>
+
+// Set some bytes to `byte_value` with SSE2. This is the fallback for CPUs
+// that do not support AVX2, so it is compiled for the baseline x86-64 ISA.
+// `tree-loop-distribute-patterns` is an optimization that replaces the loops
+// here with a call to `memset`. As this function is called within `memset`,
+// that produces an infinite loop.
+[[gnu::target("arch=x86-64"),
+  gnu::optimize("-fno-tree-loop-distribute-patterns")]] void
+cat::detail::set_memory_sse2(void* p_source, unsigned char byte_value,
+                             ssize bytes) {
+    using Vector [[gnu::vector_size(16)]] = long long;
+    // Four vectors are stored per iteration, so that several stores are in
+    // flight at once.
+    constexpr ssize step_size = ssizeof<Vector>() * 4;
+
+    unsigned char* p_current_byte = static_cast<unsigned char*>(p_source);
+    if (bytes < 32) {
+        set_memory_small(p_current_byte, byte_value, bytes);
+        return;
+    }
+
+    __UINT64_TYPE__ const word = 0x01010101'01010101u * byte_value;
+    Vector const vector = {static_cast<long long>(word),
+                           static_cast<long long>(word)};
+    unsigned char* const p_end = p_current_byte + bytes.raw;
+
+    // The unaligned head and tail are each filled by one overlapping
+    // unaligned store.
+    *static_cast<UnalignedSetVector16*>(static_cast<void*>(p_current_byte)) =
+        UnalignedSetVector16{word, word};
+    *static_cast<UnalignedSetVector16*>(static_cast<void*>(p_end - 16)) =
+        UnalignedSetVector16{word, word};
+
+    // Everything between these is filled with aligned stores.
+    p_current_byte = align_down(p_current_byte + 16, alignof(Vector));
+    unsigned char* const p_aligned_end = align_down(p_end, alignof(Vector));
+
+    // Stores larger than the cache are streamed past it, mirroring
+    // `copy_memory()`.
+    if (bytes <= non_temporal_threshold) {
+        while (p_aligned_end - p_current_byte >= step_size) {
+#pragma GCC unroll 4
+            for (int i = 0; i < 4; ++i) {
+                static_cast<Vector*>(static_cast<void*>(p_current_byte))[i] =
+                    vector;
+            }
+            p_current_byte += step_size.raw;
+        }
+    } else {
+        while (p_aligned_end - p_current_byte >= step_size) {
+#pragma GCC unroll 4
+            for (int i = 0; i < 4; ++i) {
+                __builtin_ia32_movntdq(
+                    static_cast<Vector*>(static_cast<void*>(p_current_byte)) +
+                        i,
+                    vector);
+            }
+            p_current_byte += step_size.raw;
+        }
+        __builtin_ia32_sfence();
+    }
+
+    // Fill the remaining up to three aligned vectors.
+    while (p_current_byte < p_aligned_end) {
+        *static_cast<Vector*>(static_cast<void*>(p_current_byte)) = vector;
+        p_current_byte += 16;
+    }
+}
@@ -14,6 +14,7 @@ auto main(...) -> int;  // NOLINT Without K&R, `...` is the only way to do this.
 call_main() {
     register int argc asm("rdi");
     register char** p_argv asm("rsi");
+    cat::detail::resolve_simd_kernels();
     cat::exit(main(argc, p_argv));
     __builtin_unreachable();
 }
@@ -0,0 +1,80 @@
+#include <cat/memory>
+#include <cat/runtime>
+#include <cat/simd>
+#include <cat/string>
+
+// These kernels can run on any x86-64 CPU, so they are safe to call before
+// `resolve_simd_kernels()`.
+void (*cat::detail::p_copy_memory)(void const*, void*,
+                                   ssize) = cat::detail::copy_memory_sse2;
+void (*cat::detail::p_copy_memory_small)(
+    void const*, void*, ssize) = cat::detail::copy_memory_small_sse2;
+void (*cat::detail::p_move_memory)(void const*, void*,
+                                   ssize) = cat::detail::move_memory_sse2;
+void (*cat::detail::p_set_memory)(void*, unsigned char,
+                                  ssize) = cat::detail::set_memory_sse2;
+auto (*cat::detail::p_string_length)(char const*)
+    -> ssize = cat::detail::string_length_sse2;
+auto (*cat::detail::p_compare_strings)(String const, String const)
+    -> bool = cat::detail::compare_strings_sse2;
+auto (*cat::detail::p_find_byte)(Span<Byte const>, Byte)
+    -> Optional<Sentinel<ssize, -1>> = cat::detail::find_byte_sse2;
+auto (*cat::detail::p_rfind_byte)(Span<Byte const>, Byte)
+    -> Optional<Sentinel<ssize, -1>> = cat::detail::rfind_byte_sse2;
+auto (*cat::detail::p_find_any_of)(Span<Byte const>, Span<Byte const>)
+    -> Optional<Sentinel<ssize, -1>> = cat::detail::find_any_of_sse2;
+auto (*cat::detail::p_compare_memory)(Span<Byte const>, Span<Byte const>)
+    -> int4 = cat::detail::compare_memory_sse2;
+auto (*cat::detail::p_find_subsequence)(Span<Byte const>, Span<Byte const>)
+    -> Optional<Sentinel<ssize, -1>> = cat::detail::find_subsequence_sse2;
+
+// A static executable has no dynamic loader to resolve `ifunc` symbols, so
+// kernels are dispatched through function pointers instead.
+void cat::detail::resolve_simd_kernels() {
+    __builtin_cpu_init();
+    IsaLevel const isa_level = detect_isa_level();
+
+    if (isa_level >= IsaLevel::avx2) {
+        p_copy_memory = copy_memory_avx2;
+        p_copy_memory_small = copy_memory_small_avx2;
+        p_move_memory = move_memory_avx2;
+        p_set_memory = set_memory_avx2;
+        p_string_length = string_length_avx2;
+        p_compare_strings = compare_strings_avx2;
+        p_find_byte = find_byte_avx2;
+        p_rfind_byte = rfind_byte_avx2;
+        p_find_any_of = find_any_of_avx2;
+        p_compare_memory = compare_memory_avx2;
+        p_find_subsequence = find_subsequence_avx2;
+    }
+    if (isa_level >= IsaLevel::avx512) {
+        p_copy_memory = copy_memory_avx512;
+        p_string_length = string_length_avx512;
+    }
+
+    // Copies that would evict most of the last level cache are streamed
+    // past it instead.
+    CacheSizes const cache_sizes = detect_cache_sizes();
+    ssize const last_level_cache_size =
+        (cache_sizes.l3 > 0) ? cache_sizes.l3 : cache_sizes.l2;
+    if (last_level_cache_size > 0) {
+        non_temporal_threshold = last_level_cache_size / 4;
+        non_temporal_threshold *= 3;
+    }
+
+    // With enhanced `rep movsb`, microcode copies whole cache lines at a
+    // time, which outpaces a vector loop once copies are a few times larger
+    // than the vector loop's step. Fast short `rep movsb` has less startup
+    // overhead, so it can take over sooner.
+    if (is_erms_supported()) {
+        if (is_fsrm_supported()) {
+            rep_movsb_threshold = 2_ki;
+        } else if (isa_level >= IsaLevel::avx512) {
+            rep_movsb_threshold = 8_ki;
+        } else if (isa_level >= IsaLevel::avx2) {
+            rep_movsb_threshold = 4_ki;
+        } else {
+            rep_movsb_threshold = 2_ki;
+        }
+    }
+}
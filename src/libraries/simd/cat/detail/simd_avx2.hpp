@@ -6,6 +6,11 @@
 #include <cat/numerals>
 #include <cat/simd>
 
+// The builtins in this file are only available to functions compiled for
+// AVX2.
+#pragma GCC push_options
+#pragma GCC target("avx2")
+
 namespace cat {
 
 template <typename T>
@@ -90,4 +95,20 @@ template <typename T>
     }
 }
 
+// Look up each byte of `indices` in the 16 bytes of `table` which are in the
+// same 128-bit half of the vector, with `vpshufb`. Only the low four bits of
+// an index are used, and an index with its most significant bit set produces
+// `0`.
+template <typename T>
+    requires(sizeof(T) == 1)
+[[nodiscard]] auto shuffle_bytes(Avx2Simd<T> table, Avx2Simd<T> indices)
+    -> Avx2Simd<T> {
+    using Bytes [[gnu::vector_size(32)]] = char;
+    return reinterpret_cast<typename Avx2Simd<T>::Raw>(
+        __builtin_ia32_pshufb256(reinterpret_cast<Bytes>(table.raw),
+                                 reinterpret_cast<Bytes>(indices.raw)));
+}
+
 }  // namespace cat
+
+#pragma GCC pop_options
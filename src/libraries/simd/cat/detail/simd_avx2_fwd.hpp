@@ -10,8 +10,10 @@ class alignas(Abi::alignment.raw) Simd;
 template <typename Abi, typename T>
 class alignas(Abi::alignment.raw) SimdMask;
 
-// `Avx2Abi` is a SIMD ABI that can be expected to work on most reasonable
-// x86-64 build target.
+// `Avx2Abi` is a SIMD ABI for x86-64 CPUs that support AVX2. Its vectors are
+// only usable in functions compiled for AVX2, such as those with a
+// `[[gnu::target("avx2")]]` attribute, and those functions should only be
+// called when `detect_isa_level()` returns at least `IsaLevel::avx2`.
 template <typename T>
 struct Avx2Abi {
     using Scalar = T;
@@ -33,6 +35,13 @@ using Avx2Simd = Simd<Avx2Abi<T>, T>;
 template <typename T>
 using Avx2SimdMask = SimdMask<Avx2Abi<T>, T>;
 
+}  // namespace cat
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+
+namespace cat {
+
 template <typename T>
 [[nodiscard]] auto testc(SimdMask<Avx2Abi<T>, T> left,
                          SimdMask<Avx2Abi<T>, T> right) -> int4;
@@ -53,4 +62,11 @@ template <typename T>
 template <typename T>
 [[nodiscard]] auto move_mask(SimdMask<Avx2Abi<T>, T> mask) -> int4;
 
+template <typename T>
+    requires(sizeof(T) == 1)
+[[nodiscard]] auto shuffle_bytes(Avx2Simd<T> table, Avx2Simd<T> indices)
+    -> Avx2Simd<T>;
+
 }  // namespace cat
+
+#pragma GCC pop_options
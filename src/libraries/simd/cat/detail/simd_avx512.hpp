@@ -0,0 +1,361 @@
+#pragma once
+
+#include <cat/detail/simd_avx512_fwd.hpp>
+
+#include <cat/meta>
+#include <cat/numerals>
+#include <cat/simd>
+
+// 64-byte vectors are passed between functions in `zmm` registers only when
+// both are compiled for AVX-512, so every function in this file must be. For
+// that reason, `Avx512Abi` has its own specializations of `Simd` and
+// `SimdMask`, rather than sharing the generic ones.
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512bw,avx512dq")
+
+namespace cat {
+
+namespace detail {
+    // Pack the most significant bit of each lane of a 64-byte vector into an
+    // AVX-512 `k` mask.
+    template <typename Vector>
+        requires(sizeof(Vector) == 64)
+    auto avx512_lanes_to_mask(Vector const& vector) -> __UINT64_TYPE__ {
+        using Bytes [[gnu::vector_size(64)]] = char;
+        using Words [[gnu::vector_size(64)]] = short;
+        using DoubleWords [[gnu::vector_size(64)]] = int;
+        using QuadWords [[gnu::vector_size(64)]] = long long;
+
+        if constexpr (sizeof(vector[0]) == 1) {
+            return __builtin_ia32_cvtb2mask512(
+                __builtin_bit_cast(Bytes, vector));
+        } else if constexpr (sizeof(vector[0]) == 2) {
+            return __builtin_ia32_cvtw2mask512(
+                __builtin_bit_cast(Words, vector));
+        } else if constexpr (sizeof(vector[0]) == 4) {
+            return __builtin_ia32_cvtd2mask512(
+                __builtin_bit_cast(DoubleWords, vector));
+        } else {
+            return __builtin_ia32_cvtq2mask512(
+                __builtin_bit_cast(QuadWords, vector));
+        }
+    }
+}  // namespace detail
+
+// AVX-512 masks hold one bit per lane, like a `k` register, rather than a
+// whole vector of lanes like `SimdMask`s of other ABIs.
+template <typename T>
+class SimdMask<Avx512Abi<T>, T> {
+  public:
+    using Abi = Avx512Abi<T>;
+    using Scalar = bool;
+    using Raw = __UINT64_TYPE__;
+
+  private:
+    using Mask = SimdMask<Abi, T>;
+
+  public:
+    static constexpr ssize lanes = Abi::lanes;
+    // Every bit which corresponds to a lane is set in this.
+    static constexpr Raw lanes_bits =
+        (lanes == 64) ? ~Raw{0} : ((Raw{1} << lanes.raw) - 1);
+
+    Raw raw;
+
+    constexpr SimdMask() = default;
+
+    constexpr SimdMask(Mask const& operand) = default;
+
+    constexpr SimdMask(Raw value) : raw(value & lanes_bits){};
+
+    // Construct all lanes as `value`.
+    constexpr SimdMask(bool value) : raw(value ? lanes_bits : 0u){};
+
+    // Construct from the result of comparing lanes of two `Avx512Simd`s,
+    // where each lane is all `1` bits if the comparison was `true`.
+    template <typename Comparison>
+        requires(sizeof(Comparison) == 64)
+    SimdMask(Comparison const& comparison)
+        : raw(detail::avx512_lanes_to_mask(comparison)){};
+
+    constexpr auto operator=(Mask const& operand) -> Mask& = default;
+
+    [[nodiscard]] constexpr auto operator==(Mask const& operand) const
+        -> Mask {
+        return ~(this->raw ^ operand.raw);
+    }
+
+    [[nodiscard]] constexpr auto operator!=(Mask const& operand) const
+        -> Mask {
+        return this->raw ^ operand.raw;
+    }
+
+    [[nodiscard]] constexpr auto operator&(Mask const& operand) const -> Mask {
+        return this->raw & operand.raw;
+    }
+    constexpr auto operator&=(Mask const& operand) -> Mask& {
+        this->raw = this->raw & operand.raw;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto operator|(Mask const& operand) const -> Mask {
+        return this->raw | operand.raw;
+    }
+    constexpr auto operator|=(Mask const& operand) -> Mask& {
+        this->raw = this->raw | operand.raw;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto operator~() const -> Mask {
+        return ~this->raw;
+    }
+
+    [[nodiscard]] constexpr auto operator[](ssize index) const -> bool {
+        return ((this->raw >> index.raw) & 1u) != 0u;
+    }
+
+    constexpr auto all_of() const -> bool {
+        return this->raw == lanes_bits;
+    }
+
+    constexpr auto any_of() const -> bool {
+        return this->raw != 0u;
+    }
+
+    constexpr auto fill(bool value) -> Mask {
+        this->raw = value ? lanes_bits : 0u;
+        return *this;
+    }
+
+    // Construct a `SimdMask` with every lane initialized to `value`.
+    [[nodiscard]] static constexpr auto filled(bool const value) -> Mask {
+        return Mask{value};
+    }
+};
+
+template <typename T>
+class alignas(64) Simd<Avx512Abi<T>, T> {
+    using Vector = Simd<Avx512Abi<T>, T>;
+    using Mask = SimdMask<Avx512Abi<T>, T>;
+
+  public:
+    using Abi = Avx512Abi<T>;
+    using Scalar = T;
+
+    static constexpr ssize size = Abi::size;
+    static constexpr ssize lanes = Abi::lanes;
+    static constexpr usize alignment = Abi::alignment;
+
+    using Raw [[gnu::vector_size(64), gnu::aligned(64)]] = T;
+
+  private:
+    using UnalignedRaw [[gnu::vector_size(64), gnu::aligned(1)]] = T;
+
+  public:
+    Raw raw;
+
+    constexpr Simd() = default;
+
+    constexpr Simd(Vector const& operand) = default;
+
+    constexpr Simd(Raw const& values) : raw(values){};
+
+    // Construct all lanes as `value`.
+    template <typename U>
+    constexpr Simd(U value) requires(is_convertible<U, T>) {
+        this->fill(static_cast<T>(value));
+    }
+
+    // Construct from a variadic argument list.
+    template <typename... Us>
+    constexpr Simd(Us&&... values) requires(sizeof...(values) > 1 &&
+                                            sizeof...(values) == lanes.raw)
+        : raw(Raw{static_cast<T>(forward<Us>(values))...}){};
+
+    constexpr auto operator=(Vector const& operand) -> Vector& = default;
+
+    // Compare equality for each lane to another `Simd`'s lanes, and store the
+    // results in a new `SimdMask`.
+    [[nodiscard]] auto operator==(Vector const& operand) const -> Mask {
+        return this->raw == operand.raw;
+    }
+
+    [[nodiscard]] auto operator==(T const& operand) const -> Mask {
+        return *this == Vector::filled(operand);
+    }
+
+    [[nodiscard]] auto operator!=(Vector const& operand) const -> Mask {
+        return this->raw != operand.raw;
+    }
+
+    [[nodiscard]] auto operator!=(T const& operand) const -> Mask {
+        return *this != Vector::filled(operand);
+    }
+
+    [[nodiscard]] auto operator>(Vector const& operand) const -> Mask {
+        return this->raw > operand.raw;
+    }
+
+    [[nodiscard]] auto operator>(T const& operand) const -> Mask {
+        return *this > Vector::filled(operand);
+    }
+
+    [[nodiscard]] auto operator>=(Vector const& operand) const -> Mask {
+        return this->raw >= operand.raw;
+    }
+
+    [[nodiscard]] auto operator>=(T const& operand) const -> Mask {
+        return *this >= Vector::filled(operand);
+    }
+
+    [[nodiscard]] auto operator<(Vector const& operand) const -> Mask {
+        return this->raw < operand.raw;
+    }
+
+    [[nodiscard]] auto operator<(T const& operand) const -> Mask {
+        return *this < Vector::filled(operand);
+    }
+
+    [[nodiscard]] auto operator<=(Vector const& operand) const -> Mask {
+        return this->raw <= operand.raw;
+    }
+
+    [[nodiscard]] auto operator<=(T const& operand) const -> Mask {
+        return *this <= Vector::filled(operand);
+    }
+
+    [[nodiscard]] constexpr auto operator+(Vector const& operand) const
+        -> Vector {
+        return this->raw + operand.raw;
+    }
+    constexpr auto operator+=(Vector const& operand) -> Vector& {
+        this->raw = this->raw + operand.raw;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto operator-(Vector const& operand) const
+        -> Vector {
+        return this->raw - operand.raw;
+    }
+    constexpr auto operator-=(Vector const& operand) -> Vector& {
+        this->raw = this->raw - operand.raw;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto operator*(Vector const& operand) const
+        -> Vector {
+        return this->raw * operand.raw;
+    }
+    constexpr auto operator*=(Vector const& operand) -> Vector& {
+        this->raw = this->raw * operand.raw;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto operator/(Vector const& operand) const
+        -> Vector {
+        return this->raw / operand.raw;
+    }
+    constexpr auto operator/=(Vector const& operand) -> Vector& {
+        this->raw = this->raw / operand.raw;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto operator&(Vector const& operand) const
+        -> Vector {
+        return this->raw & operand.raw;
+    }
+    constexpr auto operator&=(Vector const& operand) -> Vector& {
+        this->raw = this->raw & operand.raw;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto operator|(Vector const& operand) const
+        -> Vector {
+        return this->raw | operand.raw;
+    }
+    constexpr auto operator|=(Vector const& operand) -> Vector& {
+        this->raw = this->raw | operand.raw;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto operator^(Vector const& operand) const
+        -> Vector {
+        return this->raw ^ operand.raw;
+    }
+    constexpr auto operator^=(Vector const& operand) -> Vector& {
+        this->raw = this->raw ^ operand.raw;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto operator[](ssize index) const -> T {
+        return this->raw[index.raw];
+    }
+
+    constexpr auto fill(T value) -> Vector& {
+        // GCC broadcasts a scalar operand to every lane of a vector.
+        this->raw = Raw{} + value;
+        return *this;
+    }
+
+    // Construct a `Simd` with every lane initialized to `value`.
+    [[nodiscard]] static constexpr auto filled(T value) -> Vector {
+        return Vector{}.fill(value);
+    }
+
+    // Load a vector from `p_data`, aligned to `Abi::alignment`.
+    constexpr auto load_aligned(T const* p_data) -> Vector& {
+        this->raw = *static_cast<Raw const*>(static_cast<void const*>(p_data));
+        return *this;
+    }
+
+    // Load a vector from `p_data` with any alignment.
+    constexpr auto load_unaligned(T const* p_data) -> Vector& {
+        this->raw =
+            *static_cast<UnalignedRaw const*>(static_cast<void const*>(p_data));
+        return *this;
+    }
+
+    // Construct a `Simd` loaded from the address `p_data`, aligned to
+    // `Abi::alignment`.
+    [[nodiscard]] static constexpr auto loaded_aligned(T const* p_data)
+        -> Vector {
+        return Vector{}.load_aligned(p_data);
+    }
+
+    // Construct a `Simd` loaded from the address `p_data` with any alignment.
+    [[nodiscard]] static constexpr auto loaded_unaligned(T const* p_data)
+        -> Vector {
+        return Vector{}.load_unaligned(p_data);
+    }
+};
+
+// Implementation of `all_of()` for AVX-512.
+template <typename T>
+[[nodiscard]] auto all_of(SimdMask<Avx512Abi<T>, T> mask) -> bool {
+    return mask.all_of();
+}
+
+// Implementation of `any_of()` for AVX-512.
+template <typename T>
+[[nodiscard]] auto any_of(SimdMask<Avx512Abi<T>, T> mask) -> bool {
+    return mask.any_of();
+}
+
+// TODO: Return a `Bitset`.
+// Implementation of `move_mask` for AVX-512. Unlike the AVX2 `move_mask`,
+// this produces one bit for every lane of any type.
+template <typename T>
+[[nodiscard]] auto move_mask(Avx512Simd<T> const& vector) -> uint8 {
+    return detail::avx512_lanes_to_mask(vector.raw);
+}
+
+// TODO: Return a `Bitset`.
+// Implementation of `move_mask` for AVX-512 masks.
+template <typename T>
+[[nodiscard]] auto move_mask(SimdMask<Avx512Abi<T>, T> mask) -> uint8 {
+    return mask.raw;
+}
+
+}  // namespace cat
+
+#pragma GCC pop_options
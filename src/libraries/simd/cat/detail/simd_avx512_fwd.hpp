@@ -0,0 +1,39 @@
+#pragma once
+
+namespace cat {
+
+// Forward declarations.
+template <typename Abi, typename T>
+    requires(is_same<typename Abi::Scalar, T>)
+class alignas(Abi::alignment.raw) Simd;
+
+template <typename Abi, typename T>
+class alignas(Abi::alignment.raw) SimdMask;
+
+// `Avx512Abi` is a SIMD ABI for x86-64 CPUs that support AVX-512. Its vectors
+// are only usable in functions compiled for AVX-512, such as those with a
+// `[[gnu::target("avx512f,avx512bw,avx512dq")]]` attribute, and those
+// functions should only be called when `detect_isa_level()` returns
+// `IsaLevel::avx512`.
+template <typename T>
+struct Avx512Abi {
+    using Scalar = T;
+
+    // Produce a similar `Avx512Abi` for type `U`.
+    template <typename U>
+    using MakeAbi = Avx512Abi<U>;
+
+    Avx512Abi() = delete;
+
+    static constexpr ssize size = 64;
+    static constexpr ssize lanes = size / ssizeof<T>();
+    static constexpr usize alignment = 64u;
+};
+
+template <typename T>
+using Avx512Simd = Simd<Avx512Abi<T>, T>;
+
+template <typename T>
+using Avx512SimdMask = SimdMask<Avx512Abi<T>, T>;
+
+}  // namespace cat
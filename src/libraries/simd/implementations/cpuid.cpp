@@ -0,0 +1,11 @@
+#include <cat/simd>
+
+auto cat::detail::cpuid(__UINT32_TYPE__ leaf, __UINT32_TYPE__ subleaf)
+    -> CpuidRegisters {
+    CpuidRegisters registers;
+    asm volatile("cpuid"
+                 : "=a"(registers.eax), "=b"(registers.ebx),
+                   "=c"(registers.ecx), "=d"(registers.edx)
+                 : "a"(leaf), "c"(subleaf));
+    return registers;
+}
@@ -0,0 +1,59 @@
+#include <cat/simd>
+
+// Intel describes its caches in leaf `4`, and AMD describes them in leaf
+// `0x8000001D` with the same format. Each subleaf of those describes one
+// cache, until a subleaf has a null cache type.
+auto cat::detect_cache_sizes() -> CacheSizes {
+    auto read_cache_leaf = [](__UINT32_TYPE__ leaf) -> CacheSizes {
+        CacheSizes sizes = {};
+        for (__UINT32_TYPE__ subleaf = 0; subleaf < 16u; ++subleaf) {
+            detail::CpuidRegisters const registers =
+                detail::cpuid(leaf, subleaf);
+            __UINT32_TYPE__ const cache_type = registers.eax & 0x1fu;
+            if (cache_type == 0u) {
+                break;
+            }
+            // Instruction caches are not used by memory kernels.
+            if (cache_type == 2u) {
+                continue;
+            }
+
+            ssize const ways =
+                static_cast<ssize::Raw>((registers.ebx >> 22u) & 0x3ffu) + 1;
+            ssize const partitions =
+                static_cast<ssize::Raw>((registers.ebx >> 12u) & 0x3ffu) + 1;
+            ssize const line_size =
+                static_cast<ssize::Raw>(registers.ebx & 0xfffu) + 1;
+            ssize const sets = static_cast<ssize::Raw>(registers.ecx) + 1;
+            ssize cache_size = ways * partitions;
+            cache_size *= line_size;
+            cache_size *= sets;
+
+            switch ((registers.eax >> 5u) & 0x7u) {
+                case 1u:
+                    sizes.l1_data = cache_size;
+                    break;
+                case 2u:
+                    sizes.l2 = cache_size;
+                    break;
+                case 3u:
+                    sizes.l3 = cache_size;
+                    break;
+                default:
+                    break;
+            }
+        }
+        return sizes;
+    };
+
+    if (detail::cpuid(0u, 0u).eax >= 4u) {
+        CacheSizes const sizes = read_cache_leaf(4u);
+        if (sizes.l1_data > 0) {
+            return sizes;
+        }
+    }
+    if (detail::cpuid(0x8000'0000u, 0u).eax >= 0x8000'001Du) {
+        return read_cache_leaf(0x8000'001Du);
+    }
+    return {};
+}
@@ -0,0 +1,19 @@
+#include <cat/simd>
+
+// `__builtin_cpu_supports()` also checks that the operating system saves the
+// AVX and AVX-512 registers, so these levels are safe to run if it succeeds.
+auto cat::detect_isa_level() -> IsaLevel {
+    // libCat's AVX-512 kernels and `Avx512SimdMask` need the byte, word,
+    // doubleword and quadword instructions.
+    if (is_avx512f_supported() && is_avx512bw_supported() &&
+        is_avx512dq_supported()) {
+        return IsaLevel::avx512;
+    }
+    if (is_avx2_supported()) {
+        return IsaLevel::avx2;
+    }
+    if (is_sse4_2_supported()) {
+        return IsaLevel::sse4_2;
+    }
+    return IsaLevel::sse2;
+}
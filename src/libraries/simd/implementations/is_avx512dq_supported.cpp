@@ -0,0 +1,6 @@
+#include <cat/simd>
+
+// TODO: Document.
+auto cat::is_avx512dq_supported() -> bool {
+    return __builtin_cpu_supports("avx512dq");
+}
@@ -1,7 +1,7 @@
 #include <cat/simd>
 
 // TODO: Document.
-auto is_avx512f_supported() -> bool {
+auto cat::is_avx512f_supported() -> bool {
     __builtin_cpu_init();
     return __builtin_cpu_supports("avx512f");
 }
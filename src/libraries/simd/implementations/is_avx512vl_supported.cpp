@@ -1,6 +1,6 @@
 #include <cat/simd>
 
 // TODO: Document.
-auto is_avx512vl_supported() -> bool {
+auto cat::is_avx512vl_supported() -> bool {
     return __builtin_cpu_supports("avx512vl");
 }
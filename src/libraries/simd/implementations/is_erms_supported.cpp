@@ -0,0 +1,9 @@
+#include <cat/simd>
+
+// Enhanced `rep movsb` is reported by bit 9 of `ebx` in leaf `7`.
+auto cat::is_erms_supported() -> bool {
+    if (detail::cpuid(0u, 0u).eax < 7u) {
+        return false;
+    }
+    return ((detail::cpuid(7u, 0u).ebx >> 9u) & 1u) != 0u;
+}
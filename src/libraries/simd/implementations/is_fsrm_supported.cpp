@@ -0,0 +1,9 @@
+#include <cat/simd>
+
+// Fast short `rep movsb` is reported by bit 4 of `edx` in leaf `7`.
+auto cat::is_fsrm_supported() -> bool {
+    if (detail::cpuid(0u, 0u).eax < 7u) {
+        return false;
+    }
+    return ((detail::cpuid(7u, 0u).edx >> 4u) & 1u) != 0u;
+}
@@ -1,6 +1,6 @@
 #include <cat/simd>
 
 // TODO: Document.
-auto is_sse1_supported() -> bool {
+auto cat::is_sse1_supported() -> bool {
     return __builtin_cpu_supports("sse");
 }
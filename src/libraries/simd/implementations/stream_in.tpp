@@ -8,8 +8,15 @@
 template <typename T>
 void cat::stream_in(void* p_destination, T const* source) {
     // TODO: Make an integral-vector concept to simplify this.
+    // Streaming native 32-byte int vectors.
+    if constexpr (cat::is_same<T, cat::NativeSimd<typename T::Scalar>> &&
+                  cat::is_integral<typename T::Scalar> && sizeof(T) == 32) {
+        using Raw [[gnu::vector_size(32)]] = long long;
+        __builtin_ia32_movntdq256(static_cast<Raw*>(p_destination),
+                                  __builtin_bit_cast(Raw, source->raw));
+    }
     // Streaming 4-byte floats.
-    if constexpr (cat::is_same<T, float4x4>) {
+    else if constexpr (cat::is_same<T, float4x4>) {
         __builtin_ia32_movntps(p_destination, source);
     } else if constexpr (cat::is_same<T, float4x8>) {
         __builtin_ia32_movntps256(p_destination, source);
@@ -30,7 +37,9 @@ void cat::stream_in(void* p_destination, T const* source) {
         __builtin_ia32_movntq128(p_destination, source);
     } else if constexpr (cat::is_same<T, uint1x32> ||
                          cat::is_same<T, int1x32>) {
-        __builtin_ia32_movntq256(p_destination, source);
+        using Raw [[gnu::vector_size(32)]] = long long;
+        __builtin_ia32_movntdq256(static_cast<Raw*>(p_destination),
+                                  __builtin_bit_cast(Raw, source->raw));
     }
     // Streaming 2-byte ints.
     else if constexpr (cat::is_same<T, uint2x2> || cat::is_same<T, int2x2>) {
@@ -52,9 +61,28 @@ void cat::stream_in(void* p_destination, T const* source) {
         __builtin_ia32_movntdq256(p_destination, source);
     }
     // Streaming 8-byte ints.
-    else if constexpr (cat::is_same<T, uint1x2> || cat::is_same<T, int1x2>) {
+    else if constexpr (cat::is_same<T, uint8x2> || cat::is_same<T, int8x2>) {
         __builtin_ia32_movntq128(p_destination, source);
-    } else if constexpr (cat::is_same<T, uint1x4> || cat::is_same<T, int1x4>) {
-        __builtin_ia32_movntdq256(p_destination, source);
+    } else if constexpr (cat::is_same<T, uint8x4> || cat::is_same<T, int8x4>) {
+        using Raw [[gnu::vector_size(32)]] = long long;
+        __builtin_ia32_movntdq256(static_cast<Raw*>(p_destination),
+                                  __builtin_bit_cast(Raw, source->raw));
+    }
+}
+
+template <typename T>
+void cat::stream_in(void* p_destination, Avx512Simd<T> const* p_source) {
+    if constexpr (cat::is_same<T, float>) {
+        using Raw [[gnu::vector_size(64)]] = float;
+        __builtin_ia32_movntps512(static_cast<float*>(p_destination),
+                                  __builtin_bit_cast(Raw, p_source->raw));
+    } else if constexpr (cat::is_same<T, double>) {
+        using Raw [[gnu::vector_size(64)]] = double;
+        __builtin_ia32_movntpd512(static_cast<double*>(p_destination),
+                                  __builtin_bit_cast(Raw, p_source->raw));
+    } else {
+        using Raw [[gnu::vector_size(64)]] = long long;
+        __builtin_ia32_movntdq512(static_cast<Raw*>(p_destination),
+                                  __builtin_bit_cast(Raw, p_source->raw));
     }
 }
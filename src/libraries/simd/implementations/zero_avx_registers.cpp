@@ -1,6 +1,7 @@
 #include <cat/simd>
 
 // TODO: Document.
-void cat::zero_avx_registers() {
+// This is only called by AVX kernels, so it is compiled for AVX.
+[[gnu::target("avx")]] void cat::zero_avx_registers() {
     __builtin_ia32_vzeroall();
 }
@@ -0,0 +1,6 @@
+#include <cat/string>
+
+auto cat::compare_memory(Span<Byte const> bytes_1, Span<Byte const> bytes_2)
+    -> int4 {
+    return detail::p_compare_memory(bytes_1, bytes_2);
+}
@@ -0,0 +1,64 @@
+#include <cat/string>
+
+[[gnu::target("avx2")]] auto cat::detail::compare_memory_avx2(
+    Span<Byte const> bytes_1, Span<Byte const> bytes_2) -> int4 {
+    using Vector = char1x32;
+
+    unsigned char const* p_bytes_1 = static_cast<unsigned char const*>(
+        static_cast<void const*>(bytes_1.p_data()));
+    unsigned char const* p_bytes_2 = static_cast<unsigned char const*>(
+        static_cast<void const*>(bytes_2.p_data()));
+    ssize::Raw const size = min(bytes_1.size(), bytes_2.size()).raw;
+
+    // Order two spans by their first differing byte, or else by length.
+    auto compare_at = [&](ssize::Raw index) -> int4 {
+        return static_cast<int>(p_bytes_1[index]) -
+               static_cast<int>(p_bytes_2[index]);
+    };
+    auto compare_lengths = [&]() -> int4 {
+        if (bytes_1.size() < bytes_2.size()) {
+            return -1;
+        }
+        return (bytes_1.size() > bytes_2.size()) ? 1 : 0;
+    };
+
+    // Each bit of this is set where a pair of bytes in a vector differ.
+    // Lambdas do not inherit the `[[gnu::target()]]` of the function around
+    // them, so it is repeated here.
+    auto differences_at =
+        [&] [[gnu::target("avx2")]] (ssize::Raw index) -> __UINT32_TYPE__ {
+        Vector const vector_1 = Vector::loaded_unaligned(
+            static_cast<char const*>(
+                static_cast<void const*>(p_bytes_1 + index)));
+        Vector const vector_2 = Vector::loaded_unaligned(
+            static_cast<char const*>(
+                static_cast<void const*>(p_bytes_2 + index)));
+        return ~static_cast<__UINT32_TYPE__>(
+            move_mask(vector_1 == vector_2).raw);
+    };
+
+    ssize::Raw i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __UINT32_TYPE__ const differences = differences_at(i);
+        if (differences != 0u) {
+            return compare_at(i + __builtin_ctz(differences));
+        }
+    }
+
+    // The last partial vector is loaded so that it ends at the end of the
+    // shorter span, overlapping bytes which are already known to be equal.
+    if (size >= 32 && i < size) {
+        __UINT32_TYPE__ const differences = differences_at(size - 32);
+        if (differences != 0u) {
+            return compare_at(size - 32 + __builtin_ctz(differences));
+        }
+        return compare_lengths();
+    }
+
+    for (; i < size; ++i) {
+        if (p_bytes_1[i] != p_bytes_2[i]) {
+            return compare_at(i);
+        }
+    }
+    return compare_lengths();
+}
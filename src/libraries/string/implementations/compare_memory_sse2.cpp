@@ -0,0 +1,63 @@
+#include <cat/string>
+
+// This is compiled for the baseline x86-64 ISA, so that it can run on CPUs
+// that do not support AVX2.
+[[gnu::target("arch=x86-64")]] auto cat::detail::compare_memory_sse2(
+    Span<Byte const> bytes_1, Span<Byte const> bytes_2) -> int4 {
+    using UnalignedVector [[gnu::vector_size(16), gnu::aligned(1)]] = char;
+
+    unsigned char const* p_bytes_1 = static_cast<unsigned char const*>(
+        static_cast<void const*>(bytes_1.p_data()));
+    unsigned char const* p_bytes_2 = static_cast<unsigned char const*>(
+        static_cast<void const*>(bytes_2.p_data()));
+    ssize::Raw const size = min(bytes_1.size(), bytes_2.size()).raw;
+
+    // Order two spans by their first differing byte, or else by length.
+    auto compare_at = [&](ssize::Raw index) -> int4 {
+        return static_cast<int>(p_bytes_1[index]) -
+               static_cast<int>(p_bytes_2[index]);
+    };
+    auto compare_lengths = [&]() -> int4 {
+        if (bytes_1.size() < bytes_2.size()) {
+            return -1;
+        }
+        return (bytes_1.size() > bytes_2.size()) ? 1 : 0;
+    };
+
+    // Each of the low 16 bits of this is set where a pair of bytes in a
+    // vector differ.
+    auto differences_at = [&](ssize::Raw index) -> unsigned {
+        UnalignedVector const vector_1 = *static_cast<UnalignedVector const*>(
+            static_cast<void const*>(p_bytes_1 + index));
+        UnalignedVector const vector_2 = *static_cast<UnalignedVector const*>(
+            static_cast<void const*>(p_bytes_2 + index));
+        return ~static_cast<unsigned>(
+                   __builtin_ia32_pmovmskb128(vector_1 == vector_2)) &
+               0xffffu;
+    };
+
+    ssize::Raw i = 0;
+    for (; i + 16 <= size; i += 16) {
+        unsigned const differences = differences_at(i);
+        if (differences != 0u) {
+            return compare_at(i + __builtin_ctz(differences));
+        }
+    }
+
+    // The last partial vector is loaded so that it ends at the end of the
+    // shorter span, overlapping bytes which are already known to be equal.
+    if (size >= 16 && i < size) {
+        unsigned const differences = differences_at(size - 16);
+        if (differences != 0u) {
+            return compare_at(size - 16 + __builtin_ctz(differences));
+        }
+        return compare_lengths();
+    }
+
+    for (; i < size; ++i) {
+        if (p_bytes_1[i] != p_bytes_2[i]) {
+            return compare_at(i);
+        }
+    }
+    return compare_lengths();
+}
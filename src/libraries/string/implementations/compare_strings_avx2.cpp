@@ -0,0 +1,58 @@
+#include <cat/simd>
+#include <cat/string>
+
+[[gnu::target("avx2")]] auto cat::detail::compare_strings_avx2(
+    String const string_1, String const string_2) -> bool {
+    if (string_1.size() != string_2.size()) {
+        return false;
+    }
+
+    // TODO: Use a type for an ISA-specific widest vector.
+    using Vector = char1x32;
+
+    char const* p_string_1 = string_1.p_data();
+    char const* p_string_2 = string_2.p_data();
+    ssize::Raw const length = string_1.size().raw;
+
+    // Every bit of this is set where the vectors at `index` are equal.
+    auto equalities_at =
+        [&] [[gnu::target("avx2")]] (ssize::Raw index) -> int4::Raw {
+        return move_mask(Vector::loaded_unaligned(p_string_1 + index) ==
+                         Vector::loaded_unaligned(p_string_2 + index))
+            .raw;
+    };
+
+    // Compare four vectors of characters at a time. Their equalities are
+    // combined, so that only one branch is taken per iteration.
+    ssize::Raw i = 0;
+    for (; i + 128 <= length; i += 128) {
+        int4::Raw const equalities =
+            equalities_at(i) & equalities_at(i + 32) & equalities_at(i + 64) &
+            equalities_at(i + 96);
+        // All 32 bits are set when every character is equal.
+        if (equalities != -1) {
+            return false;
+        }
+    }
+
+    for (; i + 32 <= length; i += 32) {
+        if (equalities_at(i) != -1) {
+            return false;
+        }
+    }
+
+    // The last partial vector is loaded so that it ends at the end of the
+    // strings, overlapping characters which are already known to be equal.
+    if (length >= 32) {
+        return (i == length) || (equalities_at(length - 32) == -1);
+    }
+
+    // Strings shorter than one vector are compared individually.
+    for (; i < length; ++i) {
+        if (p_string_1[i] != p_string_2[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,6 @@
+#include <cat/string>
+
+auto cat::compare_strings_ordered(String const string_1,
+                                  String const string_2) -> int4 {
+    return compare_memory(string_1.as_bytes(), string_2.as_bytes());
+}
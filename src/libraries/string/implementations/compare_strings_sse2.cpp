@@ -0,0 +1,41 @@
+#include <cat/string>
+
+// This is compiled for the baseline x86-64 ISA, so that it can run on CPUs
+// that do not support AVX2.
+[[gnu::target("arch=x86-64")]] auto cat::detail::compare_strings_sse2(
+    String const string_1, String const string_2) -> bool {
+    using UnalignedVector [[gnu::vector_size(16), gnu::aligned(1)]] =
+        long long;
+
+    if (string_1.size() != string_2.size()) {
+        return false;
+    }
+
+    char const* p_string_1_iterator = string_1.p_data();
+    char const* p_string_2_iterator = string_2.p_data();
+    ssize::Raw length_iterator = string_1.size().raw;
+
+    // Compare one vector of characters at a time.
+    while (length_iterator >= 16) {
+        UnalignedVector const difference =
+            *static_cast<UnalignedVector const*>(
+                static_cast<void const*>(p_string_1_iterator)) ^
+            *static_cast<UnalignedVector const*>(
+                static_cast<void const*>(p_string_2_iterator));
+        if ((difference[0] | difference[1]) != 0) {
+            return false;
+        }
+        p_string_1_iterator += 16;
+        p_string_2_iterator += 16;
+        length_iterator -= 16;
+    }
+
+    // Compare remaining characters individually.
+    for (ssize::Raw i = 0; i < length_iterator; ++i) {
+        if (p_string_1_iterator[i] != p_string_2_iterator[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,6 @@
+#include <cat/string>
+
+auto cat::find_any_of(Span<Byte const> bytes, Span<Byte const> set)
+    -> Optional<Sentinel<ssize, -1>> {
+    return detail::p_find_any_of(bytes, set);
+}
@@ -0,0 +1,83 @@
+#include <cat/string>
+
+// Every byte is split into a high and a low nibble. `set` is stored as a
+// bitmap of 16 rows, one for each low nibble, where each row holds a bit for
+// each high nibble. Those rows are looked up for 32 bytes at a time with
+// `vpshufb`, which only takes 16-byte tables, so the rows for high nibbles
+// `0` through `7` and `8` through `15` are two separate tables.
+[[gnu::target("avx2")]] auto cat::detail::find_any_of_avx2(
+    Span<Byte const> bytes, Span<Byte const> set)
+    -> Optional<Sentinel<ssize, -1>> {
+    using Vector = char1x32;
+
+    if (set.size() == 1) {
+        return find_byte_avx2(bytes, set[0]);
+    }
+
+    // Both 16-byte halves of these tables are the same, because `vpshufb`
+    // looks up each half of a vector separately.
+    char low_rows[32] = {};
+    char high_rows[32] = {};
+    for (Byte const& byte : set) {
+        unsigned char const value = byte;
+        char* p_rows = ((value >> 4) < 8) ? low_rows : high_rows;
+        char const bit = static_cast<char>(1 << ((value >> 4) & 7));
+        p_rows[value & 0x0f] |= bit;
+        p_rows[(value & 0x0f) + 16] |= bit;
+    }
+
+    auto is_in_set = [&](unsigned char value) -> bool {
+        char const* p_rows = ((value >> 4) < 8) ? low_rows : high_rows;
+        return ((p_rows[value & 0x0f] >> ((value >> 4) & 7)) & 1) != 0;
+    };
+
+    Vector const low_table = Vector::loaded_unaligned(low_rows);
+    Vector const high_table = Vector::loaded_unaligned(high_rows);
+    // This maps a high nibble to its bit within a row.
+    char const bits[32] = {1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4,
+                           8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32,
+                           64, -128, 1, 2, 4, 8, 16, 32, 64, -128};
+    Vector const bits_table = Vector::loaded_unaligned(bits);
+
+    // Each bit of this is set where a byte of the vector at `index` is in
+    // `set`.
+    char const* p_bytes = static_cast<char const*>(
+        static_cast<void const*>(bytes.p_data()));
+    auto matches_at = [&] [[gnu::target("avx2")]] (ssize::Raw index) -> int4 {
+        Vector const vector = Vector::loaded_unaligned(p_bytes + index);
+        // `vpshufb` produces `0` for indices with their most significant bit
+        // set, so each table only produces rows for its own high nibbles.
+        Vector const rows =
+            shuffle_bytes(low_table, vector) |
+            shuffle_bytes(high_table, Vector{vector.raw ^ -128});
+        Vector const high_nibbles = Vector{(vector.raw >> 4) & 0x0f};
+        return move_mask((rows & shuffle_bytes(bits_table, high_nibbles)) !=
+                         '\0');
+    };
+
+    ssize::Raw const size = bytes.size().raw;
+    ssize::Raw i = 0;
+    for (; i + 32 <= size; i += 32) {
+        int4 const mask = matches_at(i);
+        if (mask != 0) {
+            return i + mask.count_trailing_zeros();
+        }
+    }
+
+    // The last partial vector is loaded so that it ends at the end of
+    // `bytes`, overlapping bytes which are already known not to match.
+    if (size >= 32 && i < size) {
+        int4 const mask = matches_at(size - 32);
+        if (mask != 0) {
+            return size - 32 + mask.count_trailing_zeros();
+        }
+        return nullopt;
+    }
+
+    for (; i < size; ++i) {
+        if (is_in_set(static_cast<unsigned char>(p_bytes[i]))) {
+            return i;
+        }
+    }
+    return nullopt;
+}
@@ -0,0 +1,29 @@
+#include <cat/string>
+
+// This is compiled for the baseline x86-64 ISA, so that it can run on CPUs
+// that do not support AVX2. SSE2 has no byte shuffle to look up a set with, so
+// `set` is stored as a bitmap of all 256 byte values instead.
+[[gnu::target("arch=x86-64")]] auto cat::detail::find_any_of_sse2(
+    Span<Byte const> bytes, Span<Byte const> set)
+    -> Optional<Sentinel<ssize, -1>> {
+    if (set.size() == 1) {
+        return find_byte_sse2(bytes, set[0]);
+    }
+
+    __UINT64_TYPE__ bitmap[4] = {};
+    for (Byte const& byte : set) {
+        unsigned char const value = byte;
+        bitmap[value >> 6] |= static_cast<__UINT64_TYPE__>(1) << (value & 63);
+    }
+
+    unsigned char const* p_bytes = static_cast<unsigned char const*>(
+        static_cast<void const*>(bytes.p_data()));
+    ssize::Raw const size = bytes.size().raw;
+    for (ssize::Raw i = 0; i < size; ++i) {
+        unsigned char const value = p_bytes[i];
+        if (((bitmap[value >> 6] >> (value & 63)) & 1u) != 0u) {
+            return i;
+        }
+    }
+    return nullopt;
+}
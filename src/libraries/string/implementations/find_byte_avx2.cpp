@@ -0,0 +1,52 @@
+#include <cat/string>
+
+[[gnu::target("avx2")]] auto cat::detail::find_byte_avx2(
+    Span<Byte const> bytes, Byte value) -> Optional<Sentinel<ssize, -1>> {
+    using Vector = char1x32;
+
+    char const* p_bytes = static_cast<char const*>(
+        static_cast<void const*>(bytes.p_data()));
+    ssize::Raw const size = bytes.size().raw;
+    Vector const values = Vector::filled(static_cast<char>(value));
+    ssize::Raw i = 0;
+
+    // Compare four vectors per iteration, and only find which of them matched
+    // once any of them did.
+    for (; i + 128 <= size; i += 128) {
+        Vector const vector_1 = Vector::loaded_unaligned(p_bytes + i);
+        Vector const vector_2 = Vector::loaded_unaligned(p_bytes + i + 32);
+        Vector const vector_3 = Vector::loaded_unaligned(p_bytes + i + 64);
+        Vector const vector_4 = Vector::loaded_unaligned(p_bytes + i + 96);
+        if (move_mask((vector_1 == values) | (vector_2 == values) |
+                      (vector_3 == values) | (vector_4 == values)) != 0) {
+            break;
+        }
+    }
+
+    for (; i + 32 <= size; i += 32) {
+        int4 const mask =
+            move_mask(Vector::loaded_unaligned(p_bytes + i) == values);
+        if (mask != 0) {
+            return i + mask.count_trailing_zeros();
+        }
+    }
+
+    // The last partial vector is loaded so that it ends at the end of
+    // `bytes`. It overlaps bytes which are already known not to match, so
+    // its first match is still the first match overall.
+    if (size >= 32 && i < size) {
+        int4 const mask = move_mask(
+            Vector::loaded_unaligned(p_bytes + size - 32) == values);
+        if (mask != 0) {
+            return size - 32 + mask.count_trailing_zeros();
+        }
+        return nullopt;
+    }
+
+    for (; i < size; ++i) {
+        if (p_bytes[i] == static_cast<char>(value)) {
+            return i;
+        }
+    }
+    return nullopt;
+}
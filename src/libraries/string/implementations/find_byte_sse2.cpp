@@ -0,0 +1,58 @@
+#include <cat/string>
+
+// This is compiled for the baseline x86-64 ISA, so that it can run on CPUs
+// that do not support AVX2.
+[[gnu::target("arch=x86-64")]] auto cat::detail::find_byte_sse2(
+    Span<Byte const> bytes, Byte value) -> Optional<Sentinel<ssize, -1>> {
+    using Vector [[gnu::vector_size(16)]] = char;
+    using UnalignedVector [[gnu::vector_size(16), gnu::aligned(1)]] = char;
+
+    char const* p_bytes = static_cast<char const*>(
+        static_cast<void const*>(bytes.p_data()));
+    ssize::Raw const size = bytes.size().raw;
+    Vector const values = Vector{} + static_cast<char>(value);
+    UnalignedVector const* p_vectors;
+    ssize::Raw i = 0;
+
+    // Compare four vectors per iteration, and only find which of them matched
+    // once any of them did.
+    for (; i + 64 <= size; i += 64) {
+        p_vectors = static_cast<UnalignedVector const*>(
+            static_cast<void const*>(p_bytes + i));
+        if (__builtin_ia32_pmovmskb128((p_vectors[0] == values) |
+                                       (p_vectors[1] == values) |
+                                       (p_vectors[2] == values) |
+                                       (p_vectors[3] == values)) != 0) {
+            break;
+        }
+    }
+
+    for (; i + 16 <= size; i += 16) {
+        p_vectors = static_cast<UnalignedVector const*>(
+            static_cast<void const*>(p_bytes + i));
+        int const mask = __builtin_ia32_pmovmskb128(*p_vectors == values);
+        if (mask != 0) {
+            return i + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+    }
+
+    // The last partial vector is loaded so that it ends at the end of
+    // `bytes`. It overlaps bytes which are already known not to match, so
+    // its first match is still the first match overall.
+    if (size >= 16 && i < size) {
+        p_vectors = static_cast<UnalignedVector const*>(
+            static_cast<void const*>(p_bytes + size - 16));
+        int const mask = __builtin_ia32_pmovmskb128(*p_vectors == values);
+        if (mask != 0) {
+            return size - 16 + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+        return nullopt;
+    }
+
+    for (; i < size; ++i) {
+        if (p_bytes[i] == static_cast<char>(value)) {
+            return i;
+        }
+    }
+    return nullopt;
+}
@@ -0,0 +1,6 @@
+#include <cat/string>
+
+auto cat::find_subsequence(Span<Byte const> haystack, Span<Byte const> needle)
+    -> Optional<Sentinel<ssize, -1>> {
+    return detail::p_find_subsequence(haystack, needle);
+}
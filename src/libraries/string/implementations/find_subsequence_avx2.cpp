@@ -0,0 +1,78 @@
+#include <cat/string>
+
+// This is a SIMD prefilter search. For 32 candidate positions at a time, the
+// first and last bytes of `needle` are compared against `haystack`, and only
+// the positions where both match are compared in full. Real data rarely
+// matches both, so the full comparisons are rare.
+[[gnu::target("avx2")]] auto cat::detail::find_subsequence_avx2(
+    Span<Byte const> haystack, Span<Byte const> needle)
+    -> Optional<Sentinel<ssize, -1>> {
+    using Vector = char1x32;
+
+    ssize::Raw const haystack_size = haystack.size().raw;
+    ssize::Raw const needle_size = needle.size().raw;
+    if (needle_size == 0) {
+        return 0;
+    }
+    if (needle_size > haystack_size) {
+        return nullopt;
+    }
+    if (needle_size == 1) {
+        return find_byte_avx2(haystack, needle[0]);
+    }
+
+    char const* p_haystack = static_cast<char const*>(
+        static_cast<void const*>(haystack.p_data()));
+    Byte const* p_needle = needle.p_data();
+    ssize::Raw const last_offset = needle_size - 1;
+    // The bytes between the first and last bytes of `needle`.
+    Span<Byte const> const needle_middle = {p_needle + 1, needle_size - 2};
+
+    // Compare the middle of `needle` to the candidate at `position`.
+    auto matches_at = [&](ssize::Raw position) -> bool {
+        Span<Byte const> const candidate = {
+            static_cast<Byte const*>(
+                static_cast<void const*>(p_haystack + position + 1)),
+            needle_size - 2};
+        return compare_memory_avx2(candidate, needle_middle) == 0;
+    };
+
+    Vector const firsts = Vector::filled(static_cast<char>(p_needle[0]));
+    Vector const lasts =
+        Vector::filled(static_cast<char>(p_needle[last_offset]));
+
+    // The last candidate position.
+    ssize::Raw const last_position = haystack_size - needle_size;
+    ssize::Raw position = 0;
+
+    // Loads of the last bytes reach `last_offset` bytes past each block, so
+    // this stops before those loads would leave `haystack`.
+    for (; position + 32 <= last_position + 1; position += 32) {
+        Vector const block_firsts =
+            Vector::loaded_unaligned(p_haystack + position);
+        Vector const block_lasts =
+            Vector::loaded_unaligned(p_haystack + position + last_offset);
+        __UINT32_TYPE__ candidates = static_cast<__UINT32_TYPE__>(
+            move_mask((block_firsts == firsts) & (block_lasts == lasts)).raw);
+
+        while (candidates != 0u) {
+            ssize::Raw const candidate = position + __builtin_ctz(candidates);
+            if (matches_at(candidate)) {
+                return candidate;
+            }
+            // Clear the lowest set bit.
+            candidates &= candidates - 1u;
+        }
+    }
+
+    // The remaining fewer than 32 positions are checked one at a time.
+    for (; position <= last_position; ++position) {
+        if (p_haystack[position] == static_cast<char>(p_needle[0]) &&
+            p_haystack[position + last_offset] ==
+                static_cast<char>(p_needle[last_offset]) &&
+            matches_at(position)) {
+            return position;
+        }
+    }
+    return nullopt;
+}
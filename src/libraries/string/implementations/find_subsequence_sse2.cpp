@@ -0,0 +1,80 @@
+#include <cat/string>
+
+// This is compiled for the baseline x86-64 ISA, so that it can run on CPUs
+// that do not support AVX2. It is the same prefilter search as
+// `find_subsequence_avx2()`, with 16 candidate positions at a time.
+[[gnu::target("arch=x86-64")]] auto cat::detail::find_subsequence_sse2(
+    Span<Byte const> haystack, Span<Byte const> needle)
+    -> Optional<Sentinel<ssize, -1>> {
+    using Vector [[gnu::vector_size(16)]] = char;
+    using UnalignedVector [[gnu::vector_size(16), gnu::aligned(1)]] = char;
+
+    ssize::Raw const haystack_size = haystack.size().raw;
+    ssize::Raw const needle_size = needle.size().raw;
+    if (needle_size == 0) {
+        return 0;
+    }
+    if (needle_size > haystack_size) {
+        return nullopt;
+    }
+    if (needle_size == 1) {
+        return find_byte_sse2(haystack, needle[0]);
+    }
+
+    char const* p_haystack = static_cast<char const*>(
+        static_cast<void const*>(haystack.p_data()));
+    Byte const* p_needle = needle.p_data();
+    ssize::Raw const last_offset = needle_size - 1;
+    // The bytes between the first and last bytes of `needle`.
+    Span<Byte const> const needle_middle = {p_needle + 1, needle_size - 2};
+
+    // Compare the middle of `needle` to the candidate at `position`.
+    auto matches_at = [&](ssize::Raw position) -> bool {
+        Span<Byte const> const candidate = {
+            static_cast<Byte const*>(
+                static_cast<void const*>(p_haystack + position + 1)),
+            needle_size - 2};
+        return compare_memory_sse2(candidate, needle_middle) == 0;
+    };
+
+    Vector const firsts = Vector{} + static_cast<char>(p_needle[0]);
+    Vector const lasts = Vector{} + static_cast<char>(p_needle[last_offset]);
+
+    // The last candidate position.
+    ssize::Raw const last_position = haystack_size - needle_size;
+    ssize::Raw position = 0;
+
+    // Loads of the last bytes reach `last_offset` bytes past each block, so
+    // this stops before those loads would leave `haystack`.
+    for (; position + 16 <= last_position + 1; position += 16) {
+        UnalignedVector const block_firsts =
+            *static_cast<UnalignedVector const*>(
+                static_cast<void const*>(p_haystack + position));
+        UnalignedVector const block_lasts =
+            *static_cast<UnalignedVector const*>(
+                static_cast<void const*>(p_haystack + position + last_offset));
+        unsigned candidates =
+            static_cast<unsigned>(__builtin_ia32_pmovmskb128(
+                (block_firsts == firsts) & (block_lasts == lasts)));
+
+        while (candidates != 0u) {
+            ssize::Raw const candidate = position + __builtin_ctz(candidates);
+            if (matches_at(candidate)) {
+                return candidate;
+            }
+            // Clear the lowest set bit.
+            candidates &= candidates - 1u;
+        }
+    }
+
+    // The remaining fewer than 16 positions are checked one at a time.
+    for (; position <= last_position; ++position) {
+        if (p_haystack[position] == static_cast<char>(p_needle[0]) &&
+            p_haystack[position + last_offset] ==
+                static_cast<char>(p_needle[last_offset]) &&
+            matches_at(position)) {
+            return position;
+        }
+    }
+    return nullopt;
+}
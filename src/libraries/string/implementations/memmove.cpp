@@ -0,0 +1,8 @@
+#include <cat/string>
+
+// `__SIZE_TYPE__` is a GCC macro.
+extern "C" auto std::memmove(void* p_destination, void const* p_source,
+                             __SIZE_TYPE__ bytes) -> void* {
+    cat::move_memory(p_source, p_destination, static_cast<ssize>(bytes));
+    return p_destination;
+}
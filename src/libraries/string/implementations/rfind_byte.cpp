@@ -0,0 +1,6 @@
+#include <cat/string>
+
+auto cat::rfind_byte(Span<Byte const> bytes, Byte value)
+    -> Optional<Sentinel<ssize, -1>> {
+    return detail::p_rfind_byte(bytes, value);
+}
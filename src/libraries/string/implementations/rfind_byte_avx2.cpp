@@ -0,0 +1,42 @@
+#include <cat/string>
+
+[[gnu::target("avx2")]] auto cat::detail::rfind_byte_avx2(
+    Span<Byte const> bytes, Byte value) -> Optional<Sentinel<ssize, -1>> {
+    using Vector = char1x32;
+
+    char const* p_bytes = static_cast<char const*>(
+        static_cast<void const*>(bytes.p_data()));
+    Vector const values = Vector::filled(static_cast<char>(value));
+    // Vectors are compared from the end of `bytes` towards its start, and
+    // `i` is the end of the next vector to compare.
+    ssize::Raw i = bytes.size().raw;
+
+    for (; i >= 32; i -= 32) {
+        __UINT32_TYPE__ const mask = static_cast<__UINT32_TYPE__>(
+            move_mask(Vector::loaded_unaligned(p_bytes + i - 32) == values)
+                .raw);
+        if (mask != 0u) {
+            // The highest set bit is the last match in this vector.
+            return i - 1 - __builtin_clz(mask);
+        }
+    }
+
+    // The first partial vector is loaded so that it starts at the start of
+    // `bytes`. It overlaps bytes which are already known not to match, so its
+    // last match is still the last match overall.
+    if (bytes.size() >= 32 && i > 0) {
+        __UINT32_TYPE__ const mask = static_cast<__UINT32_TYPE__>(
+            move_mask(Vector::loaded_unaligned(p_bytes) == values).raw);
+        if (mask != 0u) {
+            return 31 - __builtin_clz(mask);
+        }
+        return nullopt;
+    }
+
+    for (; i > 0; --i) {
+        if (p_bytes[i - 1] == static_cast<char>(value)) {
+            return i - 1;
+        }
+    }
+    return nullopt;
+}
@@ -0,0 +1,48 @@
+#include <cat/string>
+
+// This is compiled for the baseline x86-64 ISA, so that it can run on CPUs
+// that do not support AVX2.
+[[gnu::target("arch=x86-64")]] auto cat::detail::rfind_byte_sse2(
+    Span<Byte const> bytes, Byte value) -> Optional<Sentinel<ssize, -1>> {
+    using Vector [[gnu::vector_size(16)]] = char;
+    using UnalignedVector [[gnu::vector_size(16), gnu::aligned(1)]] = char;
+
+    char const* p_bytes = static_cast<char const*>(
+        static_cast<void const*>(bytes.p_data()));
+    Vector const values = Vector{} + static_cast<char>(value);
+    // Vectors are compared from the end of `bytes` towards its start, and
+    // `i` is the end of the next vector to compare.
+    ssize::Raw i = bytes.size().raw;
+
+    for (; i >= 16; i -= 16) {
+        unsigned const mask =
+            static_cast<unsigned>(__builtin_ia32_pmovmskb128(
+                *static_cast<UnalignedVector const*>(
+                    static_cast<void const*>(p_bytes + i - 16)) == values));
+        if (mask != 0u) {
+            // The highest set bit is the last match in this vector.
+            return i - 16 + (31 - __builtin_clz(mask));
+        }
+    }
+
+    // The first partial vector is loaded so that it starts at the start of
+    // `bytes`. It overlaps bytes which are already known not to match, so its
+    // last match is still the last match overall.
+    if (bytes.size() >= 16 && i > 0) {
+        unsigned const mask =
+            static_cast<unsigned>(__builtin_ia32_pmovmskb128(
+                *static_cast<UnalignedVector const*>(
+                    static_cast<void const*>(p_bytes)) == values));
+        if (mask != 0u) {
+            return 31 - __builtin_clz(mask);
+        }
+        return nullopt;
+    }
+
+    for (; i > 0; --i) {
+        if (p_bytes[i - 1] == static_cast<char>(value)) {
+            return i - 1;
+        }
+    }
+    return nullopt;
+}
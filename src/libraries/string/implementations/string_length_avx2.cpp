@@ -0,0 +1,56 @@
+#include <cat/simd>
+#include <cat/string>
+
+// This reads the whole aligned vectors around `p_string`, which the address
+// sanitizer would otherwise reject.
+[[gnu::target("avx2"), gnu::no_sanitize_address]] auto
+cat::detail::string_length_avx2(char const* p_string) -> ssize {
+    using Vector = char1x32;
+
+    // Aligned loads never cross into the next page, so reading the bytes
+    // before `p_string` in its first vector is safe.
+    __UINTPTR_TYPE__ const address =
+        __builtin_bit_cast(__UINTPTR_TYPE__, p_string);
+    __UINTPTR_TYPE__ const offset = address & (sizeof(Vector) - 1);
+    char const* p_vector = __builtin_bit_cast(char const*, address - offset);
+
+    auto nulls_at =
+        [] [[gnu::target("avx2")]] (char const* p_data) -> __UINT32_TYPE__ {
+        return static_cast<__UINT32_TYPE__>(
+            move_mask(Vector::loaded_aligned(p_data) == '\0').raw);
+    };
+
+    // Ignore the bytes before `p_string`.
+    __UINT32_TYPE__ bits = nulls_at(p_vector) >> offset;
+    if (bits != 0u) {
+        // Adding `1` is required to count the null terminator.
+        return __builtin_ctz(bits) + 1;
+    }
+    p_vector += sizeof(Vector);
+
+    // Step to a 64-byte boundary, so that both vectors of each following
+    // iteration are in the same page.
+    if ((__builtin_bit_cast(__UINTPTR_TYPE__, p_vector) & 63u) != 0u) {
+        bits = nulls_at(p_vector);
+        if (bits != 0u) {
+            return (p_vector - p_string) + __builtin_ctz(bits) + 1;
+        }
+        p_vector += sizeof(Vector);
+    }
+
+    // Scan 64 bytes per iteration, and only find which vector held the null
+    // terminator once either of them did.
+    while (true) {
+        Vector const vector_1 = Vector::loaded_aligned(p_vector);
+        Vector const vector_2 = Vector::loaded_aligned(p_vector + 32);
+        __UINT64_TYPE__ const nulls =
+            static_cast<__UINT32_TYPE__>(move_mask(vector_1 == '\0').raw) |
+            (static_cast<__UINT64_TYPE__>(static_cast<__UINT32_TYPE__>(
+                 move_mask(vector_2 == '\0').raw))
+             << 32u);
+        if (nulls != 0u) {
+            return (p_vector - p_string) + __builtin_ctzll(nulls) + 1;
+        }
+        p_vector += 64;
+    }
+}
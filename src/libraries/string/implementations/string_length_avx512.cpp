@@ -0,0 +1,31 @@
+#include <cat/simd>
+#include <cat/string>
+
+// This reads the whole aligned vectors around `p_string`, which the address
+// sanitizer would otherwise reject.
+[[gnu::target("avx512f,avx512bw,avx512dq"), gnu::no_sanitize_address]] auto
+cat::detail::string_length_avx512(char const* p_string) -> ssize {
+    // Aligned loads never cross into the next page, so reading the bytes
+    // before `p_string` in its first vector is safe.
+    __UINTPTR_TYPE__ const address =
+        __builtin_bit_cast(__UINTPTR_TYPE__, p_string);
+    __UINTPTR_TYPE__ const offset = address & (sizeof(char1x64) - 1);
+    char1x64 const* p_vector =
+        __builtin_bit_cast(char1x64 const*, address - offset);
+
+    // Ignore the bytes before `p_string`.
+    __UINT64_TYPE__ bits =
+        move_mask(*p_vector == '\0').raw >> offset;
+    ssize::Raw length = 0;
+    while (bits == 0u) {
+        length += static_cast<ssize::Raw>(sizeof(char1x64));
+        ++p_vector;
+        bits = move_mask(*p_vector == '\0').raw;
+    }
+    if (length != 0) {
+        length -= static_cast<ssize::Raw>(offset);
+    }
+
+    // Adding `1` is required to count the null terminator.
+    return length + __builtin_ctzll(bits) + 1;
+}
@@ -0,0 +1,36 @@
+#include <cat/string>
+
+// This is compiled for the baseline x86-64 ISA, so that it can run on CPUs
+// that do not support SSE4.2. It reads the whole aligned vectors around
+// `p_string`, which the address sanitizer would otherwise reject.
+[[gnu::target("arch=x86-64"), gnu::no_sanitize_address]] auto
+cat::detail::string_length_sse2(char const* p_string) -> ssize {
+    using Vector [[gnu::vector_size(16)]] = char;
+    Vector const zeros = {};
+
+    // Aligned loads never cross into the next page, so reading the bytes
+    // before `p_string` in its first vector is safe.
+    __UINTPTR_TYPE__ const address =
+        __builtin_bit_cast(__UINTPTR_TYPE__, p_string);
+    __UINTPTR_TYPE__ const offset = address & (sizeof(Vector) - 1);
+    Vector const* p_vector =
+        __builtin_bit_cast(Vector const*, address - offset);
+
+    // Ignore the bytes before `p_string`.
+    unsigned mask = static_cast<unsigned>(__builtin_ia32_pmovmskb128(
+                        *p_vector == zeros)) >>
+                    offset;
+    ssize::Raw length = 0;
+    while (mask == 0) {
+        length += static_cast<ssize::Raw>(sizeof(Vector));
+        ++p_vector;
+        mask = static_cast<unsigned>(
+            __builtin_ia32_pmovmskb128(*p_vector == zeros));
+    }
+    if (length != 0) {
+        length -= static_cast<ssize::Raw>(offset);
+    }
+
+    // Adding `1` is required to count the null terminator.
+    return length + __builtin_ctz(mask) + 1;
+}
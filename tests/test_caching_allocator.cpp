@@ -0,0 +1,136 @@
+#include <cat/atomic>
+#include <cat/caching_allocator>
+#include <cat/page_allocator>
+#include <cat/slab_allocator>
+#include <cat/thread>
+#include <cat/utility>
+
+using Pool = cat::CachingPool<cat::SlabAllocator>;
+using Allocator = cat::CachingAllocator<cat::SlabAllocator>;
+
+cat::Atomic<int> finished_threads = 0;
+cat::Atomic<int> failed_threads = 0;
+
+// Allocate and free many blocks of every size class through this thread's own
+// `CachingAllocator`.
+[[gnu::no_sanitize_address]] auto churn(Pool& pool) -> bool {
+    Allocator allocator(pool);
+    int8* p_blocks[100];
+    for (int round = 0; round < 20; ++round) {
+        for (int i = 0; i < 100; ++i) {
+            ssize const count = (i % 64) + 1;
+            p_blocks[i] = allocator.p_alloc_multi<int8>(count).or_exit();
+            p_blocks[i][0] = i;
+            p_blocks[i][count.raw - 1] = i;
+        }
+        for (int i = 0; i < 100; ++i) {
+            ssize const count = (i % 64) + 1;
+            if (p_blocks[i][0] != i || p_blocks[i][count.raw - 1] != i) {
+                return false;
+            }
+            allocator.free_multi(p_blocks[i], count);
+        }
+    }
+    return true;
+}
+
+[[gnu::no_sanitize_address]] void thread_function(void* p_pool) {
+    if (!churn(*static_cast<Pool*>(p_pool))) {
+        ++failed_threads;
+    }
+    ++finished_threads;
+    cat::exit();
+}
+
+[[gnu::no_sanitize_address]] auto main() -> int {
+    cat::SlabAllocator backing_allocator;
+    Pool pool(backing_allocator);
+
+    {
+        Allocator allocator(pool);
+
+        // Small allocations are rounded up to their size class.
+        Result(allocator.nalloc<int1>().or_exit() == 16).or_exit();
+        Result(allocator.nalloc_multi<int4>(5).or_exit() == 32).or_exit();
+
+        // A freed block is cached, and recycled by the next allocation of its
+        // size class.
+        int4* p_first = allocator.p_alloc<int4>(1).or_exit();
+        allocator.free(p_first);
+        int4* p_second = allocator.p_alloc<int4>(2).or_exit();
+        Result(p_first == p_second).or_exit();
+        Result(*p_second == 2).or_exit();
+        allocator.free(p_second);
+
+        // Blocks are naturally aligned to their size class.
+        cat::Byte* p_aligned =
+            allocator.p_align_alloc_multi<cat::Byte>(256u, 20).or_exit();
+        Result(cat::is_aligned(p_aligned, 256u)).or_exit();
+        allocator.free_multi(p_aligned, 20);
+        // An over-aligned block is recycled into the size class it was carved
+        // from, rather than the size class of its requested size.
+        cat::Byte* p_realigned =
+            allocator.p_align_alloc_multi<cat::Byte>(256u, 20).or_exit();
+        Result(p_realigned == p_aligned).or_exit();
+        allocator.free_multi(p_realigned, 20);
+
+        // Small allocations cannot be aligned to more than the largest size
+        // class.
+        Result(
+            !allocator.p_align_alloc_multi<cat::Byte>(4_uki, 20).has_value())
+            .or_exit();
+
+        // Large allocations bypass the magazines.
+        int4* p_large = allocator.p_alloc_multi<int4>(10'000).or_exit();
+        p_large[9'999] = 10;
+        Result(p_large[9'999] == 10).or_exit();
+        allocator.free_multi(p_large, 10'000);
+
+        // Overflowing a magazine spills blocks back into the pool.
+        int4* p_handles[100];
+        for (int i = 0; i < 100; ++i) {
+            p_handles[i] = allocator.p_alloc<int4>(i).or_exit();
+        }
+        for (int i = 0; i < 100; ++i) {
+            Result(*(p_handles[i]) == i).or_exit();
+            allocator.free(p_handles[i]);
+        }
+    }
+
+    // Blocks flushed by one `CachingAllocator` are reused by another. This
+    // size class has not been used yet, so its depot holds only these blocks.
+    int4* p_flushed[Allocator::batch_size.raw];
+    {
+        Allocator allocator(pool);
+        for (int4*& p_block : p_flushed) {
+            p_block = allocator.p_alloc_multi<int4>(100).or_exit();
+        }
+        for (int4* p_block : p_flushed) {
+            allocator.free_multi(p_block, 100);
+        }
+    }
+    {
+        Allocator allocator(pool);
+        int4* p_reused = allocator.p_alloc_multi<int4>(100).or_exit();
+        bool is_reused = false;
+        for (int4* p_block : p_flushed) {
+            is_reused = is_reused || (p_block == p_reused);
+        }
+        Result(is_reused).or_exit();
+        allocator.free_multi(p_reused, 100);
+    }
+
+    // Several threads allocate from the same pool at once.
+    cat::PageAllocator stack_allocator;
+    cat::Thread threads[2];
+    for (cat::Thread& thread : threads) {
+        thread.create(stack_allocator, 64_ki, thread_function, &pool)
+            .or_exit("Failed to make thread!");
+    }
+    Result(churn(pool)).or_exit();
+    while (finished_threads.load() < 2) {
+        cat::relax_cpu();
+    }
+    Result(failed_threads.load() == 0).or_exit();
+    cat::exit();
+}
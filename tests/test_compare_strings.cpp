@@ -1,3 +1,4 @@
+#include <cat/page_allocator>
 #include <cat/string>
 
 auto main() -> int {
@@ -29,7 +30,6 @@ auto main() -> int {
 
     // Test a succesful large string case.
     if (!cat::compare_strings(long_string_1, long_string_2)) {
-        // TODO: Fix this failing test!
         cat::exit(1);
     }
 
@@ -38,6 +38,39 @@ auto main() -> int {
         cat::exit(1);
     }
 
+    // Test mismatches at every position of many lengths, so that they are
+    // found in every loop and in the tail.
+    cat::PageAllocator allocator;
+    char* p_buffer_1 = allocator.p_alloc_multi<char>(300).or_exit();
+    char* p_buffer_2 = allocator.p_alloc_multi<char>(300).or_exit();
+    cat::set_memory(p_buffer_1, 'a', 300);
+    cat::set_memory(p_buffer_2, 'a', 300);
+    for (int length = 0; length < 300; length += 7) {
+        cat::String const buffer_1 = {p_buffer_1, length};
+        cat::String const buffer_2 = {p_buffer_2, length};
+        Result(cat::compare_strings(buffer_1, buffer_2)).or_exit();
+        Result(cat::compare_strings_ordered(buffer_1, buffer_2) == 0)
+            .or_exit();
+        for (int i = 0; i < length; ++i) {
+            p_buffer_2[i] = 'b';
+            Result(!cat::compare_strings(buffer_1, buffer_2)).or_exit();
+            Result(cat::compare_strings_ordered(buffer_1, buffer_2) < 0)
+                .or_exit();
+            Result(cat::compare_strings_ordered(buffer_2, buffer_1) > 0)
+                .or_exit();
+            p_buffer_2[i] = 'a';
+        }
+    }
+    allocator.free_multi(p_buffer_1, 300);
+    allocator.free_multi(p_buffer_2, 300);
+
+    // Test ordering strings of different lengths.
+    Result(cat::compare_strings_ordered({"abc", 3}, {"abd", 3}) < 0)
+        .or_exit();
+    Result(cat::compare_strings_ordered({"ab", 2}, {"abc", 3}) < 0).or_exit();
+    Result(cat::compare_strings_ordered({"b", 1}, {"abc", 3}) > 0).or_exit();
+    Result(cat::compare_strings_ordered({"", 0}, {"", 0}) == 0).or_exit();
+
     [[maybe_unused]] cat::String const_string_1 = "Hello, ";
     [[maybe_unused]] constexpr cat::String const_string_2 = "world!";
 
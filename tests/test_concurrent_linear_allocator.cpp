@@ -0,0 +1,82 @@
+#include <cat/atomic>
+#include <cat/linear_allocator>
+#include <cat/page_allocator>
+#include <cat/thread>
+#include <cat/utility>
+
+cat::Atomic<int> next_thread_id = 2;
+cat::Atomic<int> finished_threads = 0;
+cat::Atomic<int> failed_threads = 0;
+
+// Fill many allocations from a shared arena with `id`, then check that no
+// other thread overwrote them.
+[[gnu::no_sanitize_address]] auto fill(cat::ConcurrentLinearAllocator& arena,
+                                      int8 id) -> bool {
+    int8* p_allocations[500];
+    for (int i = 0; i < 500; ++i) {
+        p_allocations[i] = arena.p_alloc<int8>(id).or_exit();
+    }
+
+    // Carve a sub-arena for this thread, and allocate from it without atomic
+    // operations.
+    cat::LinearAllocator sub_arena = arena.carve(4_ki).or_exit();
+    int8* p_sub_allocations[500];
+    for (int i = 0; i < 500; ++i) {
+        p_sub_allocations[i] = sub_arena.p_alloc<int8>(id).or_exit();
+    }
+
+    for (int i = 0; i < 500; ++i) {
+        if (*(p_allocations[i]) != id || *(p_sub_allocations[i]) != id) {
+            return false;
+        }
+    }
+    return true;
+}
+
+[[gnu::no_sanitize_address]] void thread_function(void* p_arena) {
+    if (!fill(*static_cast<cat::ConcurrentLinearAllocator*>(p_arena),
+              next_thread_id++)) {
+        ++failed_threads;
+    }
+    ++finished_threads;
+    cat::exit();
+}
+
+[[gnu::no_sanitize_address]] auto main() -> int {
+    cat::PageAllocator paging_allocator;
+    cat::Byte* p_page =
+        paging_allocator.p_alloc_multi<cat::Byte>(64_ki).or_exit();
+    cat::ConcurrentLinearAllocator arena(p_page, 64_ki);
+
+    // Allocations are bumped down from the end of the arena.
+    int4* p_first = arena.p_alloc<int4>(1).or_exit();
+    int4* p_second = arena.p_alloc<int4>(2).or_exit();
+    Result(p_second == p_first - 1).or_exit();
+    Result(*p_first == 1).or_exit();
+
+    // Aligned allocations are honored.
+    int4* p_aligned = arena.p_align_alloc<int4>(64u).or_exit();
+    Result(cat::is_aligned(p_aligned, 64u)).or_exit();
+
+    // The arena runs out.
+    Result(!arena.p_alloc_multi<cat::Byte>(64_ki).has_value()).or_exit();
+    Result(!arena.carve(64_ki).has_value()).or_exit();
+
+    // A failed allocation leaves the arena usable.
+    cat::Byte* p_after_failure = arena.p_alloc<cat::Byte>().or_exit();
+    Result(static_cast<void*>(p_after_failure + 1) == p_aligned).or_exit();
+
+    // Several threads bump the same arena at once.
+    arena.reset();
+    cat::Thread threads[2];
+    for (cat::Thread& thread : threads) {
+        thread.create(paging_allocator, 64_ki, thread_function, &arena)
+            .or_exit("Failed to make thread!");
+    }
+    Result(fill(arena, 1)).or_exit();
+    while (finished_threads.load() < 2) {
+        cat::relax_cpu();
+    }
+    Result(failed_threads.load() == 0).or_exit();
+    cat::exit();
+}
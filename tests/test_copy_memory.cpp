@@ -28,4 +28,36 @@ auto main() -> int {
     for (int4 i = 0; i < 2000; ++i) {
         Result(source_2000[i] == dest_2000[i]).or_exit();
     }
+
+    // Every size bucket of small copies copies exactly the bytes requested.
+    cat::Array<char, 300> source_bytes;
+    cat::Array<char, 300> dest_bytes;
+    for (int i = 0; i < 300; ++i) {
+        source_bytes[i] = static_cast<char>((i % 127) + 1);
+    }
+    for (int size = 0; size < 290; ++size) {
+        for (int i = 0; i < 300; ++i) {
+            dest_bytes[i] = 0;
+        }
+        cat::copy_memory_small(source_bytes.p_data() + 3,
+                               dest_bytes.p_data() + 1, size);
+        Result(dest_bytes[0] == 0).or_exit();
+        for (int i = 0; i < size; ++i) {
+            Result(dest_bytes[i + 1] == source_bytes[i + 3]).or_exit();
+        }
+        Result(dest_bytes[size + 1] == 0).or_exit();
+    }
+
+    // Small copies are safe when the destination overlaps below the source.
+    for (int size = 0; size < 290; ++size) {
+        for (int i = 0; i < 300; ++i) {
+            dest_bytes[i] = static_cast<char>((i % 127) + 1);
+        }
+        cat::copy_memory_small(dest_bytes.p_data() + 5, dest_bytes.p_data(),
+                               size);
+        for (int i = 0; i < size; ++i) {
+            Result(dest_bytes[i] == static_cast<char>(((i + 5) % 127) + 1))
+                .or_exit();
+        }
+    }
 };
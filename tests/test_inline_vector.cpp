@@ -0,0 +1,61 @@
+#include <cat/inline_vector>
+#include <cat/page_allocator>
+
+auto main() -> int {
+    cat::PageAllocator allocator;
+
+    // Test that small vectors never allocate.
+    cat::InlineVector<int4, 16> small_vec;
+    Result(small_vec.size() == 0).or_exit();
+    Result(small_vec.capacity() == 16).or_exit();
+    for (int i = 0; i < 16; ++i) {
+        small_vec.push_back(allocator, i).or_exit();
+    }
+    Result(small_vec.is_inline()).or_exit();
+    Result(small_vec.capacity() == 16).or_exit();
+
+    // Test spilling to the allocator.
+    small_vec.push_back(allocator, 16).or_exit();
+    Result(!small_vec.is_inline()).or_exit();
+    Result(small_vec.capacity() == 32).or_exit();
+    for (int i = 17; i < 1'000; ++i) {
+        small_vec.push_back(allocator, i).or_exit();
+    }
+    Result(small_vec.size() == 1'000).or_exit();
+    for (int i = 0; i < 1'000; ++i) {
+        Result(small_vec[i] == i).or_exit();
+    }
+
+    // Test moving an allocated vector, which transfers its allocation.
+    cat::InlineVector<int4, 16> moved_vec = cat::move(small_vec);
+    Result(!moved_vec.is_inline()).or_exit();
+    Result(moved_vec.size() == 1'000).or_exit();
+    Result(moved_vec[999] == 999).or_exit();
+    Result(small_vec.is_inline()).or_exit();
+    Result(small_vec.size() == 0).or_exit();
+    moved_vec.free(allocator);
+    Result(moved_vec.is_inline()).or_exit();
+
+    // Test moving an inline vector, which relocates its elements.
+    cat::InlineVector<int4, 16> inline_vec;
+    inline_vec.push_back(allocator, 1).or_exit();
+    inline_vec.push_back(allocator, 2).or_exit();
+    cat::InlineVector<int4, 16> moved_inline_vec = cat::move(inline_vec);
+    Result(moved_inline_vec.is_inline()).or_exit();
+    Result(moved_inline_vec.size() == 2).or_exit();
+    Result(moved_inline_vec[1] == 2).or_exit();
+    Result(moved_inline_vec.p_data() != inline_vec.p_data()).or_exit();
+
+    // Test resizing and reserving.
+    inline_vec.resize(allocator, 8).or_exit();
+    Result(inline_vec.is_inline()).or_exit();
+    inline_vec.reserve(allocator, 100).or_exit();
+    Result(!inline_vec.is_inline()).or_exit();
+    Result(inline_vec.capacity() == 100).or_exit();
+    Result(inline_vec.size() == 8).or_exit();
+    inline_vec.free(allocator);
+
+    // By default, the inline storage fills `cat::inline_buffer_size` bytes.
+    cat::InlineVector<int4> default_vec;
+    Result(default_vec.capacity() == cat::inline_buffer_size / 4).or_exit();
+}
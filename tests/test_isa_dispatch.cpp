@@ -0,0 +1,199 @@
+#include <cat/array>
+#include <cat/memory>
+#include <cat/page_allocator>
+#include <cat/simd>
+#include <cat/string>
+
+using CopyKernel = void (*)(void const*, void*, ssize);
+
+// Copy a buffer through `p_kernel` at several sizes and alignments.
+auto test_copy_kernel(CopyKernel p_kernel, char* p_source, char* p_destination)
+    -> bool {
+    cat::Array<int, 9> const sizes = {0, 1, 15, 16, 17, 255, 256, 257, 5'000};
+    for (int offset = 0; offset < 3; ++offset) {
+        for (int size : sizes) {
+            cat::zero_memory(p_destination, 6'000);
+            p_kernel(p_source + offset, p_destination + 1, size);
+            for (int i = 0; i < size; ++i) {
+                if (p_destination[i + 1] != p_source[i + offset]) {
+                    return false;
+                }
+            }
+            if (p_destination[size + 1] != 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+auto is_same_index(cat::Optional<cat::Sentinel<ssize, -1>> index_1,
+                   cat::Optional<cat::Sentinel<ssize, -1>> index_2) -> bool {
+    if (index_1.has_value() != index_2.has_value()) {
+        return false;
+    }
+    return !index_1.has_value() || index_1.value() == index_2.value();
+}
+
+auto main() -> int {
+    cat::IsaLevel const isa_level = cat::detect_isa_level();
+
+    // Every x86-64 CPU supports SSE2, so each level implies its probes.
+    Result(cat::is_sse2_supported()).or_exit();
+    if (isa_level >= cat::IsaLevel::avx2) {
+        Result(cat::is_avx2_supported()).or_exit();
+    }
+
+    // The dispatched kernels must match the detected level.
+    if (isa_level >= cat::IsaLevel::avx512) {
+        Result(cat::detail::p_copy_memory == cat::detail::copy_memory_avx512)
+            .or_exit();
+    } else if (isa_level >= cat::IsaLevel::avx2) {
+        Result(cat::detail::p_copy_memory == cat::detail::copy_memory_avx2)
+            .or_exit();
+    }
+    if (isa_level >= cat::IsaLevel::avx2) {
+        Result(cat::detail::p_move_memory == cat::detail::move_memory_avx2)
+            .or_exit();
+        Result(cat::detail::p_find_byte == cat::detail::find_byte_avx2)
+            .or_exit();
+    } else {
+        Result(cat::detail::p_move_memory == cat::detail::move_memory_sse2)
+            .or_exit();
+        Result(cat::detail::p_find_byte == cat::detail::find_byte_sse2)
+            .or_exit();
+    }
+
+    // Every kernel that this CPU supports produces the same results.
+    cat::PageAllocator allocator;
+    char* p_source = allocator.p_alloc_multi<char>(6'000).or_exit();
+    char* p_destination = allocator.p_alloc_multi<char>(6'000).or_exit();
+    for (int i = 0; i < 6'000; ++i) {
+        p_source[i] = static_cast<char>((i % 127) + 1);
+    }
+
+    Result(test_copy_kernel(cat::detail::copy_memory_sse2, p_source,
+                            p_destination))
+        .or_exit();
+    if (isa_level >= cat::IsaLevel::avx2) {
+        Result(test_copy_kernel(cat::detail::copy_memory_avx2, p_source,
+                                p_destination))
+            .or_exit();
+    }
+    if (isa_level >= cat::IsaLevel::avx512) {
+        Result(test_copy_kernel(cat::detail::copy_memory_avx512, p_source,
+                                p_destination))
+            .or_exit();
+    }
+
+    // Cache sizes are detected, and they tune the copy thresholds.
+    cat::CacheSizes const cache_sizes = cat::detect_cache_sizes();
+    Result(cache_sizes.l1_data > 0).or_exit();
+    Result(cat::detail::non_temporal_threshold > 0).or_exit();
+
+    // Lower the thresholds so that the `rep movsb` band and the streaming
+    // loops are exercised by small buffers.
+    ssize const non_temporal_threshold = cat::detail::non_temporal_threshold;
+    ssize const rep_movsb_threshold = cat::detail::rep_movsb_threshold;
+    cat::detail::non_temporal_threshold = 1'000;
+    cat::detail::rep_movsb_threshold = 256;
+    Result(test_copy_kernel(cat::detail::copy_memory_sse2, p_source,
+                            p_destination))
+        .or_exit();
+    if (isa_level >= cat::IsaLevel::avx2) {
+        Result(test_copy_kernel(cat::detail::copy_memory_avx2, p_source,
+                                p_destination))
+            .or_exit();
+    }
+    if (isa_level >= cat::IsaLevel::avx512) {
+        Result(test_copy_kernel(cat::detail::copy_memory_avx512, p_source,
+                                p_destination))
+            .or_exit();
+    }
+    cat::detail::non_temporal_threshold = non_temporal_threshold;
+    cat::detail::rep_movsb_threshold = rep_movsb_threshold;
+
+    char const* p_string = "Hello, world!";
+    Result(cat::detail::string_length_sse2(p_string) == 14).or_exit();
+    Result(cat::detail::string_length_sse2(p_string + 5) == 9).or_exit();
+    p_source[4'999] = '\0';
+    Result(cat::detail::string_length_sse2(p_source + 3) == 4'997).or_exit();
+    if (isa_level >= cat::IsaLevel::avx2) {
+        Result(cat::detail::string_length_avx2(p_string) == 14).or_exit();
+        Result(cat::detail::string_length_avx2(p_string + 5) == 9).or_exit();
+        Result(cat::detail::string_length_avx2(p_source + 3) == 4'997)
+            .or_exit();
+    }
+    if (isa_level >= cat::IsaLevel::avx512) {
+        Result(cat::detail::string_length_avx512(p_string) == 14).or_exit();
+        Result(cat::detail::string_length_avx512(p_string + 5) == 9)
+            .or_exit();
+        Result(cat::detail::string_length_avx512(p_source + 3) == 4'997)
+            .or_exit();
+    }
+
+    // Strings which end at the end of a page must be measured without
+    // reading the next page, which is made inaccessible here.
+    char* p_pages = allocator.p_alloc_multi<char>(8'192).or_exit();
+    cat::set_memory(p_pages, 'a', 4'096);
+    p_pages[4'095] = '\0';
+    Result(nix::sys_mprotect(p_pages + 4'096, 4'096,
+                             nix::MemoryProtectionFlags::none)
+               .has_value())
+        .or_exit();
+    for (int length = 1; length <= 200; ++length) {
+        char const* p_tail = p_pages + 4'096 - length;
+        Result(cat::detail::string_length_sse2(p_tail) == length).or_exit();
+        if (isa_level >= cat::IsaLevel::avx2) {
+            Result(cat::detail::string_length_avx2(p_tail) == length)
+                .or_exit();
+        }
+        if (isa_level >= cat::IsaLevel::avx512) {
+            Result(cat::detail::string_length_avx512(p_tail) == length)
+                .or_exit();
+        }
+    }
+    Result(nix::sys_mprotect(p_pages + 4'096, 4'096,
+                             nix::MemoryProtectionFlags::read |
+                                 nix::MemoryProtectionFlags::write)
+               .has_value())
+        .or_exit();
+    allocator.free_multi(p_pages, 8'192);
+
+    cat::String const string_1 = "The quick brown fox jumps over the dog.";
+    cat::String const string_2 = "The quick brown fox jumps over the dog.";
+    cat::String const string_3 = "The quick brown fox jumps over the cat.";
+    Result(cat::detail::compare_strings_sse2(string_1, string_2)).or_exit();
+    Result(!cat::detail::compare_strings_sse2(string_1, string_3)).or_exit();
+    Result(!cat::detail::compare_strings_sse2(string_1, "The")).or_exit();
+
+    // The SSE2 search kernels agree with the dispatched kernels at every size.
+    cat::Span<cat::Byte const> const bytes = {
+        static_cast<cat::Byte const*>(static_cast<void const*>(p_source)),
+        300};
+    for (ssize size = 0; size < 300; ++size) {
+        cat::Span<cat::Byte const> const prefix = bytes.first(size);
+        cat::Span<cat::Byte const> const needle =
+            prefix.last(cat::min(size, ssize{5}));
+        cat::Byte const value = (size > 0) ? prefix[size - 1] : bytes[0];
+        Result(is_same_index(cat::detail::find_byte_sse2(prefix, value),
+                             cat::find_byte(prefix, value)))
+            .or_exit();
+        Result(is_same_index(cat::detail::rfind_byte_sse2(prefix, value),
+                             cat::rfind_byte(prefix, value)))
+            .or_exit();
+        Result(is_same_index(
+                   cat::detail::find_any_of_sse2(prefix, bytes.last(2)),
+                   cat::find_any_of(prefix, bytes.last(2))))
+            .or_exit();
+        Result(cat::detail::compare_memory_sse2(prefix, bytes) ==
+               cat::compare_memory(prefix, bytes))
+            .or_exit();
+        Result(is_same_index(cat::detail::find_subsequence_sse2(bytes, needle),
+                             cat::find_subsequence(bytes, needle)))
+            .or_exit();
+    }
+
+    allocator.free_multi(p_source, 6'000);
+    allocator.free_multi(p_destination, 6'000);
+}
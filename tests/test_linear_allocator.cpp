@@ -3,8 +3,17 @@
 #include <cat/math>
 #include <cat/numerals>
 #include <cat/page_allocator>
+#include <cat/statistics_allocator>
 #include <cat/utility>
 
+int4 destroyed_count = 0;
+
+struct TestType {
+    ~TestType() {
+        ++destroyed_count;
+    }
+};
+
 auto main() -> int {
     // Initialize an allocator.
     cat::PageAllocator paging_allocator;
@@ -89,6 +98,99 @@ overallocated:
     cat::Tuple alloc_int_size = allocator.salloc<int4>().value();
     Result(alloc_int_size.second() == 6).or_exit();
 
+    // Rolling back a checkpoint releases only the later allocations.
+    allocator.reset();
+    int4* p_kept = allocator.p_alloc<int4>(1).or_exit();
+    cat::LinearAllocator::Checkpoint checkpoint = allocator.checkpoint();
+    int4* p_temporary = allocator.p_alloc<int4>(2).or_exit();
+    allocator.rollback(checkpoint);
+    Result(allocator.p_alloc<int4>(3).or_exit() == p_temporary).or_exit();
+    Result(*p_kept == 1).or_exit();
+
+    // Scoped checkpoints nest.
+    allocator.reset();
+    int4* p_outer;
+    {
+        auto outer_checkpoint = allocator.scoped_checkpoint();
+        p_outer = allocator.p_alloc<int4>().or_exit();
+        {
+            auto inner_checkpoint = allocator.scoped_checkpoint();
+            _ = allocator.p_alloc<int4>().or_exit();
+        }
+        Result(allocator.p_alloc<int4>().or_exit() == p_outer - 1).or_exit();
+    }
+    Result(allocator.p_alloc<int4>().or_exit() == p_outer).or_exit();
+
     // TODO: Test multi allocations.
     // TODO: Test inline multi allocations.
+
+    // A chained allocator keeps allocating after its first arena is full.
+    cat::ChainedLinearAllocator chained_allocator(paging_allocator, 4_ki);
+    int4* p_chained[5'000];
+    for (int i = 0; i < 5'000; ++i) {
+        p_chained[i] = chained_allocator.p_alloc<int4>(i).or_exit();
+    }
+    for (int i = 0; i < 5'000; ++i) {
+        Result(*(p_chained[i]) == i).or_exit();
+    }
+
+    // Allocations larger than an arena get their own arena.
+    int4* p_large = chained_allocator.p_alloc_multi<int4>(10'000).or_exit();
+    p_large[9'999] = 1;
+    Result(p_large[9'999] == 1).or_exit();
+
+    // Aligned allocations work across arenas.
+    int4* p_aligned =
+        chained_allocator.p_align_alloc<int4>(1_uki).or_exit();
+    Result(cat::is_aligned(p_aligned, 1_uki)).or_exit();
+
+    // Rolling back a checkpoint frees the arenas chained after it.
+    int4* p_before = chained_allocator.p_alloc<int4>().or_exit();
+    {
+        auto chained_checkpoint = chained_allocator.scoped_checkpoint();
+        _ = chained_allocator.p_alloc_multi<int4>(100'000).or_exit();
+    }
+    Result(chained_allocator.p_alloc<int4>().or_exit() == p_before - 1)
+        .or_exit();
+
+    // Resetting keeps an arena, and allocates from its end again.
+    chained_allocator.reset();
+    int4* p_first = chained_allocator.p_alloc<int4>().or_exit();
+    chained_allocator.reset();
+    Result(chained_allocator.p_alloc<int4>().or_exit() == p_first).or_exit();
+
+    // Resetting keeps the largest arena, so that a request which needed to
+    // chain arenas does not chain any more after a reset.
+    cat::StatisticsAllocator counting_allocator(paging_allocator);
+    auto count_allocations = [&]() -> ssize {
+        ssize count = 0;
+        for (cat::AllocationSizeClass const& size_class :
+             counting_allocator.statistics().size_classes) {
+            count += size_class.allocations_count;
+        }
+        return count;
+    };
+    cat::ChainedLinearAllocator steady_allocator(counting_allocator, 4_ki);
+    _ = steady_allocator.p_alloc<int4>().or_exit();
+    _ = steady_allocator.p_alloc_multi<int4>(10'000).or_exit();
+    steady_allocator.reset();
+    ssize const chained_count = count_allocations();
+    for (int i = 0; i < 4; ++i) {
+        _ = steady_allocator.p_alloc<int4>().or_exit();
+        _ = steady_allocator.p_alloc_multi<int4>(10'000).or_exit();
+        steady_allocator.reset();
+    }
+    Result(count_allocations() == chained_count).or_exit();
+
+    // A shrink that fails to allocate leaves every element alive.
+    cat::LinearAllocator source_allocator(p_page, 1_ki);
+    cat::LinearAllocator full_allocator(p_page + 1'024, 1_ki);
+    _ = full_allocator.p_alloc_multi<cat::Byte>(1_ki).or_exit();
+    TestType* p_objects = source_allocator.p_alloc_multi<TestType>(8).or_exit();
+    Result(!source_allocator.p_realloc_multi_to(full_allocator, p_objects, 8, 2)
+                .has_value())
+        .or_exit();
+    Result(destroyed_count == 0).or_exit();
+    source_allocator.free_multi(p_objects, 8);
+    Result(destroyed_count == 8).or_exit();
 }
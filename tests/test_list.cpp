@@ -152,4 +152,46 @@ auto main() -> int {
     front_insert_iterator.insert(allocator, 2);
     Result(list_1.front() == 2).or_exit();
     Result(list_1.back() == 10).or_exit();
+
+    // Test that removed nodes are recycled.
+    list_1.clear(allocator);
+    _ = list_1.push_back(allocator, 1).or_exit();
+    int4* p_recycled = &list_1.back();
+    list_1.pop_back(allocator);
+    _ = list_1.push_back(allocator, 2).or_exit();
+    Result(&list_1.back() == p_recycled).or_exit();
+
+    // Test reserving nodes, which are handed out in address order.
+    cat::List<int4> pooled_list;
+    pooled_list.reserve_nodes(page_allocator, 100).or_exit();
+    _ = pooled_list.push_back(page_allocator, 0).or_exit();
+    int4* p_first = &pooled_list.front();
+    for (int i = 1; i < 100; ++i) {
+        _ = pooled_list.push_back(page_allocator, i).or_exit();
+    }
+    Result(&pooled_list.back() > p_first).or_exit();
+    for (int i = 0; i < 100; ++i) {
+        Result(*(pooled_list.begin() + i) == i).or_exit();
+    }
+
+    // Test growing the pool past its reserved nodes.
+    for (int i = 100; i < 1'000; ++i) {
+        _ = pooled_list.push_back(page_allocator, i).or_exit();
+    }
+    Result(pooled_list.size() == 1'000).or_exit();
+    Result(pooled_list.back() == 999).or_exit();
+    pooled_list.clear(page_allocator);
+    Result(pooled_list.size() == 0).or_exit();
+
+    // Test reserving nodes for a `ForwardList`.
+    cat::ForwardList<int4> pooled_forward_list;
+    pooled_forward_list.reserve_nodes(page_allocator, 4).or_exit();
+    _ = pooled_forward_list.push_front(page_allocator, 2).or_exit();
+    _ = pooled_forward_list.push_front(page_allocator, 1).or_exit();
+    _ = pooled_forward_list.push_front(page_allocator, 0).or_exit();
+    pooled_forward_list.erase_after(page_allocator,
+                                    pooled_forward_list.begin() + 1);
+    Result(pooled_forward_list.size() == 2).or_exit();
+    Result(pooled_forward_list.back() == 1).or_exit();
+    pooled_forward_list.clear(page_allocator);
 }
@@ -0,0 +1,77 @@
+#include <cat/page_allocator>
+#include <cat/string>
+
+auto main() -> int {
+    cat::PageAllocator allocator;
+    char* p_bytes = allocator.p_alloc_multi<char>(1'000).or_exit();
+    for (int i = 0; i < 1'000; ++i) {
+        p_bytes[i] = static_cast<char>('a' + (i % 20));
+    }
+    cat::Span<cat::Byte const> const bytes = {
+        static_cast<cat::Byte const*>(static_cast<void const*>(p_bytes)),
+        1'000};
+
+    // Find bytes in every vector loop and in the tail.
+    Result(cat::find_byte(bytes, 'a').value() == 0).or_exit();
+    Result(cat::find_byte(bytes, 't').value() == 19).or_exit();
+    p_bytes[500] = 'z';
+    Result(cat::find_byte(bytes, 'z').value() == 500).or_exit();
+    p_bytes[998] = 'y';
+    Result(cat::find_byte(bytes, 'y').value() == 998).or_exit();
+    Result(!cat::find_byte(bytes, 'x').has_value()).or_exit();
+    for (int size = 0; size < 70; ++size) {
+        cat::Span<cat::Byte const> const prefix = {bytes.p_data(), size};
+        Result(cat::find_byte(prefix, 'z').has_value() == false).or_exit();
+        Result(cat::find_byte(prefix, 'c').has_value() == (size > 2))
+            .or_exit();
+    }
+
+    // Compare memory lexicographically.
+    char* p_other = allocator.p_alloc_multi<char>(1'000).or_exit();
+    cat::copy_memory(p_bytes, p_other, 1'000);
+    cat::Span<cat::Byte const> const other = {
+        static_cast<cat::Byte const*>(static_cast<void const*>(p_other)),
+        1'000};
+    Result(cat::compare_memory(bytes, other) == 0).or_exit();
+    p_other[700] = 'A';
+    Result(cat::compare_memory(bytes, other) > 0).or_exit();
+    Result(cat::compare_memory(other, bytes) < 0).or_exit();
+    p_other[700] = p_bytes[700];
+    p_other[10] = static_cast<char>(0xff);
+    // Bytes are ordered as unsigned.
+    Result(cat::compare_memory(bytes, other) < 0).or_exit();
+    p_other[10] = p_bytes[10];
+    // A prefix orders first.
+    cat::Span<cat::Byte const> const short_prefix = {bytes.p_data(), 40};
+    Result(cat::compare_memory(short_prefix, other) < 0).or_exit();
+    Result(cat::compare_memory(other, short_prefix) > 0).or_exit();
+    Result(cat::compare_memory(bytes.first(0), other.first(0)) == 0)
+        .or_exit();
+
+    // Find subsequences.
+    // String literals count their null terminator, so this is sized explicitly.
+    cat::String const needle = {"needle", 6};
+    cat::Span<cat::Byte const> const needle_bytes = {
+        static_cast<cat::Byte const*>(
+            static_cast<void const*>(needle.p_data())),
+        needle.size()};
+    Result(!cat::find_subsequence(bytes, needle_bytes).has_value()).or_exit();
+    cat::copy_memory(needle.p_data(), p_bytes + 600, needle.size());
+    Result(cat::find_subsequence(bytes, needle_bytes).value() == 600)
+        .or_exit();
+    // A needle at the very end is only reached by the scalar tail.
+    cat::copy_memory(needle.p_data(), p_bytes + 994, needle.size());
+    p_bytes[600] = 'x';
+    Result(cat::find_subsequence(bytes, needle_bytes).value() == 994)
+        .or_exit();
+    // A partial match is not a match.
+    p_bytes[997] = 'x';
+    Result(!cat::find_subsequence(bytes, needle_bytes).has_value()).or_exit();
+    Result(cat::find_subsequence(bytes, needle_bytes.first(0)).value() == 0)
+        .or_exit();
+    Result(cat::find_subsequence(needle_bytes, bytes).has_value() == false)
+        .or_exit();
+
+    allocator.free_multi(p_bytes, 1'000);
+    allocator.free_multi(p_other, 1'000);
+}
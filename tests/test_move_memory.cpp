@@ -0,0 +1,95 @@
+#include <cat/memory>
+#include <cat/numerals>
+#include <cat/page_allocator>
+
+auto main() -> int {
+    cat::PageAllocator allocator;
+    int4* p_buffer = allocator.p_alloc_multi<int4>(1'000'000).or_exit();
+
+    // Move memory backward, into an overlapping range.
+    for (int4 i = 0; i < 2'000; ++i) {
+        p_buffer[i.raw] = i;
+    }
+    cat::move_memory(p_buffer + 1, p_buffer, 1'999 * 4);
+    for (int4 i = 0; i < 1'999; ++i) {
+        Result(p_buffer[i.raw] == i + 1).or_exit();
+    }
+
+    // Move memory forward, into an overlapping range.
+    for (int4 i = 0; i < 2'000; ++i) {
+        p_buffer[i.raw] = i;
+    }
+    cat::move_memory(p_buffer, p_buffer + 3, 1'997 * 4);
+    for (int4 i = 3; i < 2'000; ++i) {
+        Result(p_buffer[i.raw] == i - 3).or_exit();
+    }
+    Result(p_buffer[2] == 2).or_exit();
+
+    // Move unaligned bytes in both directions.
+    char* p_bytes = static_cast<char*>(static_cast<void*>(p_buffer));
+    for (int i = 0; i < 1'000; ++i) {
+        p_bytes[i] = static_cast<char>(i % 100);
+    }
+    cat::move_memory(p_bytes + 1, p_bytes + 8, 900);
+    Result(p_bytes[7] == 7).or_exit();
+    for (int i = 0; i < 900; ++i) {
+        Result(p_bytes[i + 8] == static_cast<char>((i + 1) % 100)).or_exit();
+    }
+    cat::move_memory(p_bytes + 8, p_bytes + 1, 900);
+    for (int i = 0; i < 900; ++i) {
+        Result(p_bytes[i + 1] == static_cast<char>((i + 1) % 100)).or_exit();
+    }
+
+    // Move every size up to a few steps backward, into a range that
+    // overlaps the source by only a few bytes.
+    for (int size = 0; size < 1'000; ++size) {
+        for (int i = 0; i < 1'100; ++i) {
+            p_bytes[i] = static_cast<char>(i % 100);
+        }
+        cat::move_memory(p_bytes + 3, p_bytes + 5, size);
+        for (int i = 0; i < size; ++i) {
+            Result(p_bytes[i + 5] == static_cast<char>((i + 3) % 100))
+                .or_exit();
+        }
+        Result(p_bytes[size + 5] == static_cast<char>((size + 5) % 100))
+            .or_exit();
+    }
+
+    // Move memory that does not overlap.
+    for (int4 i = 0; i < 1'000'000; ++i) {
+        p_buffer[i.raw] = i;
+    }
+    cat::move_memory(p_buffer, p_buffer + 500'000, 100'000 * 4);
+    Result(p_buffer[500'000] == 0).or_exit();
+    Result(p_buffer[599'999] == 99'999).or_exit();
+    Result(p_buffer[600'000] == 600'000).or_exit();
+
+    allocator.free_multi(p_buffer, 1'000'000);
+
+    // Move memory larger than the non-temporal threshold in both directions,
+    // so that it is streamed past the cache.
+    int4::Raw const large_count =
+        static_cast<int4::Raw>(cat::detail::non_temporal_threshold.raw / 2);
+    int4* p_large = allocator.p_alloc_multi<int4>(large_count).or_exit();
+    for (int4 i = 0; i < large_count; ++i) {
+        p_large[i.raw] = i;
+    }
+    cat::move_memory(p_large + 100, p_large + 1, (large_count - 100) * 4);
+    Result(p_large[0] == 0).or_exit();
+    for (int4 i = 1; i < large_count - 99; ++i) {
+        Result(p_large[i.raw] == i + 99).or_exit();
+    }
+
+    for (int4 i = 0; i < large_count; ++i) {
+        p_large[i.raw] = i;
+    }
+    cat::move_memory(p_large + 1, p_large + 100, (large_count - 100) * 4);
+    for (int4 i = 0; i < 100; ++i) {
+        Result(p_large[i.raw] == i).or_exit();
+    }
+    for (int4 i = 100; i < large_count; ++i) {
+        Result(p_large[i.raw] == i - 99).or_exit();
+    }
+
+    allocator.free_multi(p_large, large_count);
+};
@@ -16,6 +16,13 @@ struct TestType {
     }
 };
 
+// This constructor does not initialize any data.
+struct Page {
+    char storage[4'096];
+
+    Page(){};
+};
+
 auto main() -> int {
     // Initialize an allocator.
     cat::PageAllocator allocator;
@@ -98,4 +105,144 @@ auto main() -> int {
     allocator.get(aligned_mem)[0] = 10;
     Result(allocator.get(aligned_mem)[0] == 10).or_exit();
     allocator.free(aligned_mem);
+
+    // Alignments greater than a page are honored.
+    char* p_over_aligned =
+        allocator.p_align_alloc_multi<char>(64_uki, 5'000).or_exit();
+    Result(cat::is_aligned(p_over_aligned, 64_uki)).or_exit();
+    p_over_aligned[4'999] = 1;
+    allocator.free_multi(p_over_aligned, 5'000);
+
+    // Resizing pages preserves their contents without copying them.
+    int4* p_grown = allocator.p_alloc_multi<int4>(1'000).or_exit();
+    p_grown[0] = 1;
+    p_grown[999] = 2;
+    p_grown = allocator.p_realloc_multi(p_grown, 1'000, 1'000'000).or_exit();
+    Result(p_grown[0] == 1).or_exit();
+    Result(p_grown[999] == 2).or_exit();
+    Result(p_grown[999'999] == 0).or_exit();
+    p_grown[999'999] = 3;
+    cat::Tuple sized_shrunk =
+        allocator.p_resalloc_multi(p_grown, 1'000'000, 10).or_exit();
+    Result(sized_shrunk.first()[0] == 1).or_exit();
+    Result(sized_shrunk.second() == 4_ki).or_exit();
+    allocator.free_multi(sized_shrunk.first(), 10);
+
+    // Grown pages are already zeroed, but elements in the old last page are
+    // still value-initialized after a shrink left stale data in it.
+    int4* p_stale = allocator.p_alloc_multi<int4>(1'000).or_exit();
+    p_stale[999] = 5;
+    p_stale = allocator.p_realloc_multi(p_stale, 1'000, 500).or_exit();
+    p_stale = allocator.p_realloc_multi(p_stale, 500, 1'000'000).or_exit();
+    Result(p_stale[999] == 0).or_exit();
+    Result(p_stale[999'999] == 0).or_exit();
+    allocator.free_multi(p_stale, 1'000'000);
+
+    // Shrinking into another allocator only relocates the elements that fit.
+    cat::PageAllocator other_allocator;
+    int4* p_moved_shrunk = allocator.p_alloc_multi<int4>(2'000).or_exit();
+    p_moved_shrunk[9] = 4;
+    p_moved_shrunk =
+        allocator.p_realloc_multi_to(other_allocator, p_moved_shrunk, 2'000, 10)
+            .or_exit();
+    Result(p_moved_shrunk[9] == 4).or_exit();
+    other_allocator.free_multi(p_moved_shrunk, 10);
+
+    // Over-aligned pages are resized without losing their alignment.
+    char* p_aligned_grown =
+        allocator.p_align_alloc_multi<char>(64_uki, 4_ki).or_exit();
+    p_aligned_grown[0] = 1;
+    p_aligned_grown = allocator
+                          .p_align_realloc_multi(p_aligned_grown, 64_uki,
+                                                 4_ki, 1_mi)
+                          .or_exit();
+    Result(cat::is_aligned(p_aligned_grown, 64_uki)).or_exit();
+    Result(p_aligned_grown[0] == 1).or_exit();
+    allocator.free_multi(p_aligned_grown, 1_mi);
+
+    // Reserve a gibibyte of virtual memory, and commit only some of it.
+    char* p_reserved =
+        static_cast<char*>(allocator.reserve(1_gi).or_exit());
+    allocator.commit(p_reserved, 64_ki).or_exit();
+    p_reserved[(64_ki - 1).raw] = 1;
+    allocator.commit(p_reserved + (512_mi).raw, 4_ki).or_exit();
+    p_reserved[(512_mi).raw] = 2;
+    Result(p_reserved[(64_ki - 1).raw] == 1).or_exit();
+    // Decommitted pages are zeroed when they are committed again.
+    allocator.decommit(p_reserved, 64_ki);
+    allocator.commit(p_reserved, 64_ki).or_exit();
+    Result(p_reserved[(64_ki - 1).raw] == 0).or_exit();
+    allocator.release(p_reserved, 1_gi);
+
+    // Lazy allocations are not prefaulted.
+    cat::PageAllocator lazy_allocator(cat::HugePages::none, cat::nullopt,
+                                      false);
+    Page* p_lazy = lazy_allocator.p_alloc_multi<Page>(256_ki).or_exit();
+    p_lazy[(256_ki - 1).raw].storage[0] = 1;
+    lazy_allocator.free_multi(p_lazy, 256_ki);
+
+    // Huge page allocations are rounded up to 2 mebibytes.
+    cat::PageAllocator huge_allocator(cat::HugePages::transparent);
+    Result(huge_allocator.nalloc_multi<char>(1).or_exit() == 2_mi)
+        .or_exit();
+    char* p_huge =
+        huge_allocator.p_align_alloc_multi<char>(2_umi, 3_mi).or_exit();
+    Result(cat::is_aligned(p_huge, 2_umi)).or_exit();
+    p_huge[(3_mi - 1).raw] = 1;
+    huge_allocator.free_multi(p_huge, 3_mi);
+    // Unaligned huge page allocations are still aligned to a huge page.
+    char* p_huge_default = huge_allocator.p_alloc_multi<char>(1).or_exit();
+    Result(cat::is_aligned(p_huge_default, 2_umi)).or_exit();
+    // Growing huge pages keeps them aligned to a huge page.
+    p_huge_default =
+        huge_allocator.p_realloc_multi(p_huge_default, 1, 8_mi).or_exit();
+    Result(cat::is_aligned(p_huge_default, 2_umi)).or_exit();
+    p_huge_default[(8_mi - 1).raw] = 1;
+    huge_allocator.free_multi(p_huge_default, 8_mi);
+    // Alignments greater than a huge page are honored, and the whole range
+    // is mapped.
+    char* p_huge_over_aligned =
+        huge_allocator.p_align_alloc_multi<char>(4_umi, 2_mi).or_exit();
+    Result(cat::is_aligned(p_huge_over_aligned, 4_umi)).or_exit();
+    p_huge_over_aligned[0] = 1;
+    p_huge_over_aligned[(2_mi - 1).raw] = 1;
+    huge_allocator.free_multi(p_huge_over_aligned, 2_mi);
+
+    // `hugetlb` pages fall back to transparent huge pages if none are
+    // reserved.
+    cat::PageAllocator hugetlb_allocator(cat::HugePages::hugetlb);
+    int4* p_hugetlb = hugetlb_allocator.p_alloc<int4>(1).or_exit();
+    Result(*p_hugetlb == 1).or_exit();
+    hugetlb_allocator.free(p_hugetlb);
+    char* p_hugetlb_over_aligned =
+        hugetlb_allocator.p_align_alloc_multi<char>(8_umi, 2_mi).or_exit();
+    Result(cat::is_aligned(p_hugetlb_over_aligned, 8_umi)).or_exit();
+    p_hugetlb_over_aligned[0] = 1;
+    p_hugetlb_over_aligned[(2_mi - 1).raw] = 1;
+    hugetlb_allocator.free_multi(p_hugetlb_over_aligned, 2_mi);
+
+    // Alignments greater than a huge page are honored without huge pages.
+    char* p_page_over_aligned =
+        allocator.p_align_alloc_multi<char>(4_umi, 2_mi).or_exit();
+    Result(cat::is_aligned(p_page_over_aligned, 4_umi)).or_exit();
+    p_page_over_aligned[(2_mi - 1).raw] = 1;
+    allocator.free_multi(p_page_over_aligned, 2_mi);
+
+    // Pages can be bound to a NUMA node.
+    cat::PageAllocator numa_allocator(cat::HugePages::none, 0u);
+    int4* p_numa = numa_allocator.p_alloc_multi<int4>(1'000).or_exit();
+    p_numa[999] = 1;
+    p_numa = numa_allocator.p_realloc_multi(p_numa, 1'000, 100'000).or_exit();
+    p_numa[99'999] = 1;
+    numa_allocator.free_multi(p_numa, 100'000);
+
+    // Elements that do not survive a shrink are destroyed exactly once.
+    int4 const destroyed_count = global_int_2;
+    TestType* p_objects = allocator.p_alloc_multi<TestType>(8).or_exit();
+    p_objects =
+        allocator.p_realloc_multi_to(other_allocator, p_objects, 8, 2)
+            .or_exit();
+    // 6 elements are destroyed, and 2 are destroyed after being moved from.
+    Result(global_int_2 - destroyed_count == 8).or_exit();
+    other_allocator.free_multi(p_objects, 2);
 };
@@ -21,4 +21,27 @@ auto main() -> int {
     cat::zero_memory(p_page, 4_ki);
     Result(p_page[0] == 0_u1).or_exit();
     Result(p_page[(4_ki).raw - 1] == 0_u1).or_exit();
+
+    // Test every small size, which are set by overlapping stores.
+    for (int size = 0; size < 64; ++size) {
+        cat::zero_memory(p_page, 128);
+        cat::set_memory(p_page + 1, 3_u1, size);
+        Result(p_page[0] == 0_u1).or_exit();
+        Result(p_page[size + 1] == 0_u1).or_exit();
+        for (int i = 1; i <= size; ++i) {
+            Result(p_page[i] == 3_u1).or_exit();
+        }
+    }
+
+    // Test setting memory larger than the non-temporal threshold, so that it
+    // is streamed past the cache.
+    ssize const large_size = cat::detail::non_temporal_threshold * 2;
+    uint1* p_large = allocator.p_alloc_multi<uint1>(large_size).or_exit();
+    cat::set_memory(p_large + 1, 4_u1, large_size - 2);
+    Result(p_large[0] == 0_u1).or_exit();
+    Result(p_large[1] == 4_u1).or_exit();
+    Result(p_large[(large_size / 2).raw] == 4_u1).or_exit();
+    Result(p_large[(large_size - 2).raw] == 4_u1).or_exit();
+    Result(p_large[(large_size - 1).raw] == 0_u1).or_exit();
+    allocator.free_multi(p_large, large_size);
 };
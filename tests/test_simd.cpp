@@ -1,6 +1,32 @@
 #include <cat/simd>
 
-auto main() -> int {
+// AVX-512 vectors can only be used in functions compiled for AVX-512.
+[[gnu::target("avx512f,avx512bw,avx512dq")]] void test_avx512() {
+    int4x16 vec1 = int4x16::filled(1);
+    int4x16 const vec2 = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+    vec1 += vec2;
+
+    // Comparisons produce a bit for every lane.
+    cat::Avx512SimdMask<int4::Raw> const mask = vec1 > int4x16::filled(8);
+    Result(mask.raw == 0b1111'1111'0000'0000u).or_exit();
+    Result(mask.any_of()).or_exit();
+    Result(!mask.all_of()).or_exit();
+    Result((mask | ~mask).all_of()).or_exit();
+    Result(mask[8] && !mask[7]).or_exit();
+
+    char1x64 const chars = char1x64::filled('a');
+    Result((chars == 'a').all_of()).or_exit();
+    Result(cat::move_mask(chars == 'b') == 0u).or_exit();
+
+    // Vectors can be streamed into aligned memory.
+    alignas(64) char1x64 destination;
+    cat::stream_in(&destination, &chars);
+    cat::sfence();
+    Result(cat::move_mask(destination == 'a') == ~0ull).or_exit();
+}
+
+// These vectors can only be used in functions compiled for AVX2.
+[[gnu::target("avx2")]] void test_avx2() {
     // Test that vector arithmetic does not segfault.
     int4x4 vec1 = {0, 1, 2, 3};
     int4x4 vec2{0, 1, 2, 3};
@@ -9,3 +35,13 @@ auto main() -> int {
 
     // TODO: Test correctness of vector operations.
 }
+
+auto main() -> int {
+    cat::IsaLevel const isa_level = cat::detect_isa_level();
+    if (isa_level >= cat::IsaLevel::avx2) {
+        test_avx2();
+    }
+    if (isa_level == cat::IsaLevel::avx512) {
+        test_avx512();
+    }
+}
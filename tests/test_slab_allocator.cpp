@@ -0,0 +1,93 @@
+#include <cat/bit>
+#include <cat/numerals>
+#include <cat/slab_allocator>
+#include <cat/utility>
+
+int4 global_int_1 = 0;
+int4 global_int_2 = 0;
+
+struct TestType {
+    TestType() {
+        ++global_int_1;
+    }
+    ~TestType() {
+        ++global_int_2;
+    }
+};
+
+auto main() -> int {
+    // Initialize an allocator.
+    cat::SlabAllocator allocator;
+
+    // Small allocations are rounded up to their size class.
+    Result(allocator.nalloc<int1>().or_exit() == 16).or_exit();
+    Result(allocator.nalloc_multi<int4>(5).or_exit() == 32).or_exit();
+    Result(allocator.nalloc_multi<int4>(512).or_exit() == 2_ki).or_exit();
+    // Large allocations are rounded up to pages.
+    Result(allocator.nalloc_multi<int4>(513).or_exit() == 4_ki).or_exit();
+
+    // Freed blocks are recycled by the next allocation of their size class.
+    int4* p_first = allocator.p_alloc<int4>(1).or_exit();
+    Result(*p_first == 1).or_exit();
+    allocator.free(p_first);
+    int4* p_second = allocator.p_alloc<int4>(2).or_exit();
+    Result(p_first == p_second).or_exit();
+    Result(*p_second == 2).or_exit();
+
+    // Blocks from the same size class do not overlap.
+    int4* p_handles[100];
+    for (int i = 0; i < 100; ++i) {
+        p_handles[i] = allocator.p_alloc<int4>(i).or_exit();
+    }
+    for (int i = 0; i < 100; ++i) {
+        Result(*(p_handles[i]) == i).or_exit();
+        allocator.free(p_handles[i]);
+    }
+
+    // Enough allocations to fill several slabs succeed.
+    for (int i = 0; i < 100; ++i) {
+        _ = allocator.p_alloc_multi<cat::Byte>(2_ki).or_exit();
+    }
+
+    // Blocks are naturally aligned to their size class.
+    cat::Byte* p_aligned =
+        allocator.p_align_alloc_multi<cat::Byte>(256u, 20).or_exit();
+    Result(cat::is_aligned(p_aligned, 256u)).or_exit();
+    allocator.free_multi(p_aligned, 20);
+    // An over-aligned block is recycled into the size class it was carved
+    // from, rather than the size class of its requested size.
+    cat::Byte* p_realigned =
+        allocator.p_align_alloc_multi<cat::Byte>(256u, 20).or_exit();
+    Result(p_realigned == p_aligned).or_exit();
+    allocator.free_multi(p_realigned, 20);
+
+    // Small allocations cannot be aligned to more than the largest size class.
+    Result(!allocator.p_align_alloc_multi<cat::Byte>(4_uki, 20).has_value())
+        .or_exit();
+    // Large allocations can be aligned to more than a page.
+    cat::Byte* p_large_aligned =
+        allocator.p_align_alloc_multi<cat::Byte>(64_uki, 5'000).or_exit();
+    Result(cat::is_aligned(p_large_aligned, 64_uki)).or_exit();
+    allocator.free_multi(p_large_aligned, 5'000);
+
+    // Large allocations are paged.
+    int4* p_large = allocator.p_alloc_multi<int4>(10'000).or_exit();
+    p_large[9'999] = 10;
+    Result(p_large[9'999] == 10).or_exit();
+    allocator.free_multi(p_large, 10'000);
+
+    // Test constructors and destructors.
+    auto handle = allocator.alloc<TestType>().or_exit();
+    allocator.free(handle);
+    Result(global_int_1 == 1).or_exit();
+    Result(global_int_2 == 1).or_exit();
+
+    auto array_handle = allocator.alloc_multi<TestType>(9).or_exit();
+    Result(global_int_1 == 10).or_exit();
+    allocator.free(array_handle);
+    Result(global_int_2 == 10).or_exit();
+
+    // All slabs are unmapped after a reset, and the allocator is still usable.
+    allocator.reset();
+    _ = allocator.p_alloc<int4>().or_exit();
+}
@@ -0,0 +1,56 @@
+#include <cat/page_allocator>
+#include <cat/statistics_allocator>
+#include <cat/utility>
+
+int4 traced_allocations = 0;
+int4 traced_deallocations = 0;
+
+void trace(cat::AllocationEvent const& event) {
+    if (event.is_deallocation) {
+        ++traced_deallocations;
+    } else {
+        ++traced_allocations;
+    }
+}
+
+auto main() -> int {
+    cat::PageAllocator paging_allocator;
+    cat::StatisticsAllocator allocator(paging_allocator, trace);
+    cat::AllocatorStatistics const& stats = allocator.statistics();
+
+    // Allocations are counted in their size class.
+    int4* p_small = allocator.p_alloc<int4>(1).or_exit();
+    Result(*p_small == 1).or_exit();
+    Result(stats.size_classes[0].allocations_count == 1).or_exit();
+    Result(stats.size_classes[0].allocated_bytes == 4).or_exit();
+    Result(stats.current_bytes == 4).or_exit();
+
+    int4* p_large = allocator.p_alloc_multi<int4>(1'000).or_exit();
+    ssize const large_class = allocator.size_class_index(4'000);
+    Result(stats.size_classes[large_class.raw].allocations_count == 1)
+        .or_exit();
+    Result(stats.current_bytes == 4'004).or_exit();
+    Result(stats.peak_bytes == 4'004).or_exit();
+
+    // Freeing memory lowers the live bytes, but not the peak.
+    allocator.free_multi(p_large, 1'000);
+    allocator.free(p_small);
+    Result(stats.current_bytes == 0).or_exit();
+    Result(stats.peak_bytes == 4'004).or_exit();
+    Result(stats.size_classes[0].deallocations_count == 1).or_exit();
+
+    // Every allocation is in the latency histogram.
+    ssize timed_allocations = 0;
+    for (ssize count : stats.latency_histogram) {
+        timed_allocations += count;
+    }
+    Result(timed_allocations == 2).or_exit();
+
+    // Every allocation and deallocation was traced.
+    Result(traced_allocations == 2).or_exit();
+    Result(traced_deallocations == 2).or_exit();
+
+    // Counters can be reset.
+    allocator.reset_statistics();
+    Result(stats.peak_bytes == 0).or_exit();
+}
@@ -0,0 +1,83 @@
+#include <cat/page_allocator>
+#include <cat/string>
+
+auto main() -> int {
+    cat::PageAllocator allocator;
+    char* p_text = allocator.p_alloc_multi<char>(500).or_exit();
+    for (int i = 0; i < 500; ++i) {
+        p_text[i] = static_cast<char>('a' + (i % 20));
+    }
+    cat::String const text = {p_text, 500};
+
+    // Find any of a set of characters, in vectors and in the tail.
+    Result(!text.find_any_of({"xyz", 3}).has_value()).or_exit();
+    Result(text.find_any_of({"ts", 2}).value() == 18).or_exit();
+    Result(text.find_any_of({"ts", 2}, 19).value() == 19).or_exit();
+    p_text[300] = '\n';
+    p_text[480] = static_cast<char>(0xe9);
+    Result(text.find_any_of({"\n\t ", 3}).value() == 300).or_exit();
+    // Characters with their most significant bit set are found.
+    char const high_set[2] = {static_cast<char>(0xe9), 'z'};
+    Result(text.find_any_of({high_set, 2}).value() == 480).or_exit();
+    for (int size = 0; size < 40; ++size) {
+        cat::String const prefix = {p_text, size};
+        Result(prefix.find_any_of({"dq", 2}).has_value() == (size > 3))
+            .or_exit();
+    }
+    p_text[300] = 'u';
+    p_text[480] = 'a';
+
+    // Find substrings.
+    Result(text.find({"ghij", 4}).value() == 6).or_exit();
+    Result(text.find({"ghij", 4}, 7).value() == 26).or_exit();
+    Result(!text.find({"ghji", 4}).has_value()).or_exit();
+
+    // Searches that start past the end of a string find nothing.
+    Result(!text.find({"ghij", 4}, 501).has_value()).or_exit();
+    Result(!text.find_any_of({"ts", 2}, 501).has_value()).or_exit();
+    Result(!text.find('a', 501).has_value()).or_exit();
+    Result(text.find({"", 0}, 500).value() == 500).or_exit();
+
+    // Find the last occurrence of a character.
+    Result(text.rfind('a').value() == 480).or_exit();
+    Result(text.rfind('t').value() == 499).or_exit();
+    Result(!text.rfind('z').has_value()).or_exit();
+    Result(cat::String{p_text, 10}.rfind('b').value() == 1).or_exit();
+    Result(!cat::String{p_text, 1}.rfind('b').has_value()).or_exit();
+
+    // Split strings lazily.
+    cat::String const lines = {"one\ntwo\n\nthree", 14};
+    cat::String const expected[4] = {{"one", 3}, {"two", 3}, {"", 0},
+                                     {"three", 5}};
+    int count = 0;
+    for (cat::String line : lines.split('\n')) {
+        Result(count < 4).or_exit();
+        Result(cat::compare_strings(line, expected[count])).or_exit();
+        ++count;
+    }
+    Result(count == 4).or_exit();
+
+    // A trailing delimiter produces a trailing empty substring, and an empty
+    // string produces one empty substring.
+    count = 0;
+    for (cat::String line : cat::String{"a,", 2}.split(',')) {
+        Result(line.size() == ((count == 0) ? 1 : 0)).or_exit();
+        ++count;
+    }
+    Result(count == 2).or_exit();
+    count = 0;
+    for (cat::String line : cat::String{}.split(',')) {
+        Result(line.size() == 0).or_exit();
+        ++count;
+    }
+    Result(count == 1).or_exit();
+
+    // Split a long string, so that delimiters are found with vectors.
+    count = 0;
+    for ([[maybe_unused]] cat::String field : text.split('t')) {
+        ++count;
+    }
+    Result(count == 26).or_exit();
+
+    allocator.free_multi(p_text, 500);
+}
@@ -18,6 +18,22 @@ consteval auto const_func() -> int4 {
     return vector[8];
 }
 
+// This is not trivially relocatable, so `Vector` must move it element by
+// element.
+struct NonTrivial {
+    int4 value = 0;
+
+    NonTrivial() = default;
+    constexpr NonTrivial(int input) : value(input){};
+    NonTrivial(NonTrivial const&) = default;
+    auto operator=(NonTrivial const&) -> NonTrivial& = default;
+    auto operator=(NonTrivial&& other) -> NonTrivial& {
+        this->value = other.value;
+        other.value = -1;
+        return *this;
+    }
+};
+
 auto main() -> int {
     cat::PageAllocator page_allocator;
     cat::Byte* page = page_allocator.p_alloc_multi<cat::Byte>(4_ki).or_exit();
@@ -55,6 +71,10 @@ auto main() -> int {
     Result(int_vec.size() == 4).or_exit();
     Result(int_vec.capacity() == 128).or_exit();
 
+    // Reserving less than the current capacity does nothing.
+    int_vec.reserve(allocator, 2).or_exit();
+    Result(int_vec.capacity() == 128).or_exit();
+
     // Test reserve constructor.
     cat::Vector reserved_vec =
         cat::Vector<int4>::reserved(allocator, 6).or_exit();
@@ -89,6 +109,118 @@ auto main() -> int {
     Result(from_vec_2.capacity() == 4).or_exit();
     Result(from_vec_2.size() == 4).or_exit();
 
+    // Test growing a `Vector` of trivially relocatable elements.
+    static_assert(cat::is_trivially_relocatable<int4>);
+    static_assert(cat::is_trivially_relocatable<cat::Vector<int4>>);
+    cat::Vector<int4> trivial_vec;
+    for (int i = 0; i < 1'000; ++i) {
+        trivial_vec.push_back(page_allocator, i).or_exit();
+    }
+    for (int i = 0; i < 1'000; ++i) {
+        Result(trivial_vec[i] == i).or_exit();
+    }
+
+    // Test growing a `Vector` of non-trivially relocatable elements.
+    static_assert(!cat::is_trivially_relocatable<NonTrivial>);
+    cat::Vector<NonTrivial> non_trivial_vec;
+    for (int i = 0; i < 100; ++i) {
+        non_trivial_vec.push_back(page_allocator, NonTrivial{i}).or_exit();
+    }
+    non_trivial_vec.reserve(page_allocator, 1'000).or_exit();
+    for (int i = 0; i < 100; ++i) {
+        Result(non_trivial_vec[i].value == i).or_exit();
+    }
+
+    // Test growing a `Vector` in place at the end of a `LinearAllocator`.
+    // Without growing in place, the outgrown storage would not leave room
+    // for a capacity of `1'024` in this arena.
+    cat::Byte* p_arena =
+        page_allocator.p_alloc_multi<cat::Byte>(4_ki).or_exit();
+    cat::LinearAllocator arena_allocator = {p_arena, 4_ki};
+    cat::Vector<int4> arena_vec;
+    for (int i = 0; i < 600; ++i) {
+        arena_vec.push_back(arena_allocator, i).or_exit();
+    }
+    Result(arena_vec.capacity() == 1'024).or_exit();
+    for (int i = 0; i < 600; ++i) {
+        Result(arena_vec[i] == i).or_exit();
+    }
+
+    // Test filling a `Vector` of bytes.
+    cat::Vector filled_bytes =
+        cat::Vector<char>::filled(page_allocator, 100, 'a').or_exit();
+    for (char byte : filled_bytes) {
+        Result(byte == 'a').or_exit();
+    }
+
+    // Test filling a `Vector` with more elements than one copy doubles.
+    cat::Vector filled_ints =
+        cat::Vector<int4>::filled(page_allocator, 1'000, 3).or_exit();
+    Result(filled_ints.size() == 1'000).or_exit();
+    for (int4 integer : filled_ints) {
+        Result(integer == 3).or_exit();
+    }
+
+    // Test appending to a `Vector`, which grows its storage once.
+    int4 values[6] = {0, 1, 2, 3, 4, 5};
+    cat::Vector<int4> bulk_vec;
+    bulk_vec.append(page_allocator, cat::Span<int4 const>{values, 3}).or_exit();
+    Result(bulk_vec.size() == 3).or_exit();
+    Result(bulk_vec.capacity() == 3).or_exit();
+    bulk_vec.append(page_allocator, cat::Span<int4 const>{values + 3, 3})
+        .or_exit();
+    Result(bulk_vec.size() == 6).or_exit();
+    Result(bulk_vec.capacity() == 6).or_exit();
+    for (int i = 0; i < 6; ++i) {
+        Result(bulk_vec[i] == i).or_exit();
+    }
+
+    // Test inserting into a `Vector`.
+    bulk_vec.insert(page_allocator, 2, cat::Span<int4 const>{values, 2})
+        .or_exit();
+    Result(bulk_vec.size() == 8).or_exit();
+    Result(bulk_vec.capacity() == 12).or_exit();
+    int4 const inserted[8] = {0, 1, 0, 1, 2, 3, 4, 5};
+    for (int i = 0; i < 8; ++i) {
+        Result(bulk_vec[i] == inserted[i]).or_exit();
+    }
+
+    // Test erasing from a `Vector`.
+    bulk_vec.erase_range(1, 4);
+    Result(bulk_vec.size() == 5).or_exit();
+    int4 const erased[5] = {0, 2, 3, 4, 5};
+    for (int i = 0; i < 5; ++i) {
+        Result(bulk_vec[i] == erased[i]).or_exit();
+    }
+
+    // Test emplacing into a `Vector`.
+    bulk_vec.emplace_back(page_allocator, 10).or_exit();
+    Result(bulk_vec.size() == 6).or_exit();
+    Result(bulk_vec[5] == 10).or_exit();
+
+    // Test the bulk operations on non-trivially relocatable elements.
+    NonTrivial non_trivial_values[3] = {1, 2, 3};
+    cat::Vector<NonTrivial> non_trivial_bulk;
+    non_trivial_bulk
+        .append(page_allocator,
+                cat::Span<NonTrivial const>{non_trivial_values, 3})
+        .or_exit();
+    non_trivial_bulk
+        .insert(page_allocator, 1,
+                cat::Span<NonTrivial const>{non_trivial_values, 2})
+        .or_exit();
+    non_trivial_bulk.emplace_back(page_allocator, 4).or_exit();
+    int4 const non_trivial_inserted[6] = {1, 1, 2, 2, 3, 4};
+    Result(non_trivial_bulk.size() == 6).or_exit();
+    for (int i = 0; i < 6; ++i) {
+        Result(non_trivial_bulk[i].value == non_trivial_inserted[i])
+            .or_exit();
+    }
+    non_trivial_bulk.erase_range(0, 2);
+    Result(non_trivial_bulk.size() == 4).or_exit();
+    Result(non_trivial_bulk[0].value == 2).or_exit();
+    Result(non_trivial_bulk[3].value == 4).or_exit();
+
     // Test `Vector` in a `constexpr` context.
     static_assert(const_func() == 10);
 